@@ -10,6 +10,9 @@ Tokenizer Unit Test for Expression Evaluator Project.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Added allocation count case.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -555,4 +558,20 @@ GATS_TEST_CASE(unknown_token) {
 	#endif // TEST_FUNCTION && TEST_SINGLE_ARG
 #endif // TEST_VARIABLE
 
+
+
+
+/* Allocations: one per token, plus the list and a few lexeme strings */
+#if TEST_INTEGER && TEST_BINARY_OPERATOR && TEST_PARENTHESIS
+	GATS_TEST_CASE(tokenize_allocations) {
+		Tokenizer tkr;
+		(void)tkr.tokenize("0");
+
+		GATS_TRACK_ALLOCATIONS();
+		TokenList tl = tkr.tokenize("12 + 3 * (4 - 5) / 6 + 70 - 8 * 9");
+		GATS_CHECK_ALLOCS_AT_MOST(3 * tl.size());
+		GATS_CHECK(tl.size() == 17);
+	}
+#endif // TEST_INTEGER && TEST_BINARY_OPERATOR && TEST_PARENTHESIS
+
 #endif // TEST_TOKENIZER
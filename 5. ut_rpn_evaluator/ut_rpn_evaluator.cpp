@@ -11,6 +11,12 @@ Reverse-Polish Evaluator unit test for Expression Evaluator Project.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Added exp/ln/log/arctan kernel cases; arctan2 compared after rounding.
+	Added fast mode cases.
+	Added JIT cases.
+	Added allocation count cases.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -61,6 +67,7 @@ the program(s) have been supplied.
 #include <ee/boolean.hpp>
 #include <ee/integer.hpp>
 #include <ee/function.hpp>
+#include <ee/jit.hpp>
 #include <ee/operator.hpp>
 #include <ee/real.hpp>
 #include <ee/variable.hpp>
@@ -657,6 +664,34 @@ GATS_TEST_CASE(no_operand) {
 				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.0")), make<Ln>() });
 				GATS_CHECK(round(value_of<Real>(result)) == boost::multiprecision::log(Real::value_type("1.0")));
 			}
+			GATS_TEST_CASE(test_ln_e) {
+				auto result = RPNEvaluator().evaluate({ make<Real>(boost::math::constants::e<Real::value_type>()), make<Ln>() });
+				GATS_CHECK(round(value_of<Real>(result)) == round(Real::value_type("1.0")));
+			}
+			GATS_TEST_CASE(test_ln_small) {
+				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.0000000001")), make<Ln>() });
+				GATS_CHECK(round(value_of<Real>(result)) == round(boost::multiprecision::log(Real::value_type("1.0000000001"))));
+			}
+			GATS_TEST_CASE(test_log) {
+				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1000.0")), make<Log>() });
+				GATS_CHECK(round(value_of<Real>(result)) == round(Real::value_type("3.0")));
+			}
+			GATS_TEST_CASE(test_exp_ln_round_trip) {
+				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("12.5")), make<Ln>(), make<Exp>() });
+				GATS_CHECK(round(value_of<Real>(result)) == round(Real::value_type("12.5")));
+			}
+			GATS_TEST_CASE(test_exp_negative) {
+				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("-20.25")), make<Exp>() });
+				GATS_CHECK(round(value_of<Real>(result)) == round(boost::multiprecision::exp(Real::value_type("-20.25"))));
+			}
+			GATS_TEST_CASE(test_atan_one) {
+				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.0")), make<Arctan>() });
+				GATS_CHECK(round(result) == round(Real::value_type(boost::math::constants::pi<Real::value_type>() / 4)));
+			}
+			GATS_TEST_CASE(test_atan_large) {
+				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("-1234.5")), make<Arctan>() });
+				GATS_CHECK(round(result) == round(boost::multiprecision::atan(Real::value_type("-1234.5"))));
+			}
 			GATS_TEST_CASE(test_sin) {
 				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("0.0")), make<Sin>() });
 				GATS_CHECK(round(value_of<Real>(result)) == Real::value_type("0.0"));
@@ -705,7 +740,7 @@ GATS_TEST_CASE(no_operand) {
 		#if TEST_REAL
 			GATS_TEST_CASE(test_arctan2) {
 				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.0")), make<Real>(Real::value_type("2.0")), make<Arctan2>() });
-				GATS_CHECK(value_of<Real>(result) == atan2(Real::value_type("1.0"), Real::value_type("2.0")));
+				GATS_CHECK(round(result) == round(atan2(Real::value_type("1.0"), Real::value_type("2.0"))));
 			}
 			GATS_TEST_CASE(test_max_real_real_rhs) {
 				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.0")), make<Real>(Real::value_type("2.0")), make<Max>() });
@@ -769,4 +804,100 @@ GATS_TEST_CASE(no_operand) {
 			}
 		#endif // TEST_MIXED
 	#endif // TEST_MULTI_ARG
-#endif // TEST_FUNCTION
\ No newline at end of file
+#endif // TEST_FUNCTION
+
+
+
+#if TEST_REAL && TEST_MIXED
+	GATS_TEST_CASE(fast_mode_certified_real) {
+		RPNEvaluator rpn;
+		rpn.set_fast_mode(12);
+		auto result = rpn.evaluate({ make<Real>(Real::value_type("1.5")), make<Real>(Real::value_type("2.25")), make<Multiplication>(), make<Sqrt>() });
+		GATS_CHECK(round(result) == round(Real::value_type("1.83711730709")));
+		GATS_CHECK(rpn.fast_count() == 1);
+		GATS_CHECK(rpn.fallback_count() == 0);
+	}
+	GATS_TEST_CASE(fast_mode_exact_integer) {
+		RPNEvaluator rpn;
+		rpn.set_fast_mode(12);
+		auto result = rpn.evaluate({ make<Integer>(7), make<Integer>(2), make<Division>(), make<Integer>(30), make<Power>() });
+		GATS_CHECK(is<Integer>(result));
+		GATS_CHECK(value_of<Integer>(result) == boost::multiprecision::pow(Integer::value_type(3), 30));
+		GATS_CHECK(rpn.fast_count() == 1);
+	}
+	GATS_TEST_CASE(fast_mode_cancellation_falls_back) {
+		RPNEvaluator rpn;
+		rpn.set_fast_mode(12);
+		auto result = rpn.evaluate({ make<Real>(Real::value_type("1e20")), make<Real>(Real::value_type("1.5")), make<Addition>(), make<Real>(Real::value_type("1e20")), make<Subtraction>() });
+		GATS_CHECK(round(result) == round(Real::value_type("1.5")));
+		GATS_CHECK(rpn.fast_count() == 0);
+		GATS_CHECK(rpn.fallback_count() == 1);
+	}
+	GATS_TEST_CASE(fast_mode_large_integer_falls_back) {
+		RPNEvaluator rpn;
+		rpn.set_fast_mode(12);
+		auto result = rpn.evaluate({ make<Integer>(2), make<Integer>(60), make<Power>() });
+		GATS_CHECK(value_of<Integer>(result) == boost::multiprecision::pow(Integer::value_type(2), 60));
+		GATS_CHECK(rpn.fallback_count() == 1);
+	}
+	GATS_TEST_CASE(fast_mode_domain_error_falls_back) {
+		RPNEvaluator rpn;
+		rpn.set_fast_mode(12);
+		GATS_CHECK_THROW(rpn.evaluate({ make<Integer>(1), make<Integer>(0), make<Division>() }), std::runtime_error);
+		GATS_CHECK(rpn.fallback_count() == 1);
+	}
+#endif // TEST_REAL && TEST_MIXED
+
+
+
+#if TEST_REAL
+	GATS_TEST_CASE(jit_variable_arithmetic) {
+		auto x = make<Variable>();
+		auto fn = JitFunction::compile({ x, make<Real>(Real::value_type("1.5")), make<Multiplication>(), make<Real>(Real::value_type("2.0")), make<Addition>() });
+		if (!fn) return;	// platform without a JIT
+		GATS_CHECK(fn->variables().size() == 1);
+		double const args[] = { 3.0 };
+		GATS_CHECK((*fn)(args) == 6.5);
+	}
+	GATS_TEST_CASE(jit_folds_integer_division) {
+		auto fn = JitFunction::compile({ make<Integer>(7), make<Integer>(2), make<Division>(), make<Variable>(), make<Addition>() });
+		if (!fn) return;
+		double const args[] = { 0.5 };
+		GATS_CHECK((*fn)(args) == 3.5);
+	}
+	GATS_TEST_CASE(jit_rejects_unsupported) {
+		GATS_CHECK(JitFunction::compile({ make<Variable>(), make<Integer>(4), make<Assignment>() }) == nullptr);
+		GATS_CHECK(JitFunction::compile({ make<Variable>(), make<Factorial>() }) == nullptr);
+		GATS_CHECK(JitFunction::compile({ make<Integer>(2), make<Integer>(60), make<Power>() }) == nullptr);
+	}
+#endif // TEST_REAL
+
+
+
+/* Allocations: a repeated evaluation allocates its results and a little stack, a bounded number per token */
+#if TEST_INTEGER && TEST_BINARY_OPERATOR
+	GATS_TEST_CASE(evaluate_allocations) {
+		RPNEvaluator rpn;
+		TokenList const tl{ make<Integer>(3), make<Integer>(4), make<Addition>(), make<Integer>(5), make<Multiplication>(),
+			make<Integer>(6), make<Integer>(7), make<Subtraction>(), make<Addition>() };
+		(void)rpn.evaluate(tl);
+
+		GATS_TRACK_ALLOCATIONS();
+		auto result = rpn.evaluate(tl);
+		GATS_CHECK_ALLOCS_AT_MOST(2 * tl.size());
+		GATS_CHECK(value_of<Integer>(result) == 34);
+	}
+#endif // TEST_INTEGER && TEST_BINARY_OPERATOR
+
+#if TEST_REAL && TEST_MIXED
+	GATS_TEST_CASE(evaluate_real_peak_bytes) {
+		RPNEvaluator rpn;
+		TokenList const tl{ make<Real>(Real::value_type("1.5")), make<Integer>(4), make<Addition>() };
+		(void)rpn.evaluate(tl);
+
+		GATS_TRACK_ALLOCATIONS();
+		auto result = rpn.evaluate(tl);
+		GATS_CHECK_PEAK_BYTES_AT_MOST(4 * sizeof(Real));
+		GATS_CHECK(value_of<Real>(result) == Real::value_type("5.5"));
+	}
+#endif // TEST_REAL && TEST_MIXED
@@ -0,0 +1,115 @@
+/*! \file	bench_alloc.cpp
+	\brief	Counts heap allocations for the benchmark suite.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Replaces the global operator new and delete (every form the
+standard lets a program replace) with versions that count calls
+and bytes before forwarding to malloc/free.  The counters are
+relaxed atomics, so they cost a few nanoseconds per allocation and
+are exact across threads.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "benchmarks.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+
+namespace {
+	std::atomic<std::uint64_t> allocationCount{ 0 };
+	std::atomic<std::uint64_t> allocatedBytes{ 0 };
+
+	[[nodiscard]] void* counted_alloc(std::size_t size, std::size_t alignment) noexcept {
+		if (size == 0)
+			size = 1;
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+		allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+		if (alignment <= alignof(std::max_align_t))
+			return std::malloc(size);
+#if defined(_WIN32)
+		return _aligned_malloc(size, alignment);
+#else
+		void* p = nullptr;
+		return posix_memalign(&p, alignment, size) == 0 ? p : nullptr;
+#endif
+	}
+
+	void counted_free(void* p, std::size_t alignment) noexcept {
+#if defined(_WIN32)
+		if (alignment > alignof(std::max_align_t)) {
+			_aligned_free(p);
+			return;
+		}
+#else
+		(void)alignment;
+#endif
+		std::free(p);
+	}
+
+	[[nodiscard]] void* throwing_alloc(std::size_t size, std::size_t alignment) {
+		for (;;) {
+			if (void* p = counted_alloc(size, alignment))
+				return p;
+			auto const handler = std::get_new_handler();
+			if (!handler)
+				throw std::bad_alloc();
+			handler();
+		}
+	}
+}
+
+
+
+bench::Allocations bench::allocations() {
+	return { allocationCount.load(std::memory_order_relaxed), allocatedBytes.load(std::memory_order_relaxed) };
+}
+
+
+
+constexpr std::size_t default_alignment = alignof(std::max_align_t);
+
+void* operator new(std::size_t size) { return throwing_alloc(size, default_alignment); }
+void* operator new[](std::size_t size) { return throwing_alloc(size, default_alignment); }
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept { return counted_alloc(size, default_alignment); }
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept { return counted_alloc(size, default_alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return throwing_alloc(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return throwing_alloc(size, static_cast<std::size_t>(alignment)); }
+void* operator new(std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept { return counted_alloc(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept { return counted_alloc(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void* p) noexcept { counted_free(p, default_alignment); }
+void operator delete[](void* p) noexcept { counted_free(p, default_alignment); }
+void operator delete(void* p, std::size_t) noexcept { counted_free(p, default_alignment); }
+void operator delete[](void* p, std::size_t) noexcept { counted_free(p, default_alignment); }
+void operator delete(void* p, std::nothrow_t const&) noexcept { counted_free(p, default_alignment); }
+void operator delete[](void* p, std::nothrow_t const&) noexcept { counted_free(p, default_alignment); }
+void operator delete(void* p, std::align_val_t alignment) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* p, std::align_val_t alignment) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete(void* p, std::size_t, std::align_val_t alignment) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* p, std::size_t, std::align_val_t alignment) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete(void* p, std::align_val_t alignment, std::nothrow_t const&) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* p, std::align_val_t alignment, std::nothrow_t const&) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
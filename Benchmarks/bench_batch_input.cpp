@@ -0,0 +1,152 @@
+/*! \file	bench_batch_input.cpp
+	\brief	Compares the batch input paths: getline, block reads and MappedFile.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Writes a temporary expression file, then splits it into lines
+with each input path and reports the throughput.  The file is
+read once before timing, so every path runs from the page
+cache and the figures compare the copying and scanning, not
+the disk.  The tokenize rows hand each line to Tokenizer, as
+batch mode does.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "benchmarks.hpp"
+#include <ee/batch_io.hpp>
+#include <ee/mapped_file.hpp>
+#include <ee/tokenizer.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+
+namespace {
+	constexpr std::size_t scan_lines = 2'000'000;
+	constexpr std::size_t tokenize_lines = 100'000;
+
+	char const* const samples[] = {
+		"x * 3 + y - 12 / 4",
+		"sqrt(2.25) * (17 % 5) + abs(0 - 9)",
+		"max(3, 7) ** 2 - min(1.5, 2) / 3",
+		"(1 + 2) * (3 + 4) * (5 + 6) - 7!",
+	};
+
+	void write_input(std::string const& path, std::size_t lines) {
+		std::ofstream out(path, std::ios::binary);
+		for (std::size_t i = 0; i < lines; ++i)
+			out << samples[i % std::size(samples)] << " + " << i << '\n';
+	}
+
+	/*! Seconds taken by one call to 'f'. */
+	template <typename F>
+	double seconds(F&& f) {
+		return bench::time_us(f, 1) / 1e6;
+	}
+
+	void report(std::ostream& os, char const* name, double secs, std::size_t bytes, std::size_t lines) {
+		os << "    " << std::left << std::setw(24) << name << std::right
+			<< std::setw(9) << bytes / secs / (1 << 20) << " MiB/s"
+			<< std::setw(9) << lines / secs / 1e6 << " Mlines/s\n";
+	}
+}
+
+
+
+void bench_batch_input(std::ostream& os) {
+	os << "\nBatch input: getline vs block reads vs MappedFile\n";
+	os << std::fixed << std::setprecision(1);
+
+	auto const path = (std::filesystem::temp_directory_path() / "ee_bench_input.txt").string();
+	write_input(path, scan_lines);
+	auto const bytes = static_cast<std::size_t>(std::filesystem::file_size(path));
+	os << "  " << scan_lines << " lines, " << bytes / (1 << 20) << " MiB\n";
+
+	std::size_t total = 0, lines = 0;
+	auto const count = [&](std::string_view line) { total += line.size(); ++lines; };
+
+	{	// warm the page cache
+		MappedFile file(path);
+		total += count_lines(file.contents());
+	}
+
+	os << "  split into lines\n";
+	report(os, "getline(ifstream)", seconds([&] {
+		std::ifstream in(path, std::ios::binary);
+		for (std::string line; std::getline(in, line); )
+			count(line);
+	}), bytes, scan_lines);
+	report(os, "for_each_line(FILE*)", seconds([&] {
+		std::FILE* in = std::fopen(path.c_str(), "rb");
+		for_each_line(in, count);
+		std::fclose(in);
+	}), bytes, scan_lines);
+	report(os, "MappedFile + memchr", seconds([&] {
+		MappedFile file(path);
+		auto const text = file.contents();
+		for (char const* p = text.data(), *end = p + text.size(); p != end; ) {
+			auto const nl = static_cast<char const*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+			auto const stop = nl ? nl : end;
+			count(std::string_view(p, static_cast<std::size_t>(stop - p)));
+			p = nl ? nl + 1 : end;
+		}
+	}), bytes, scan_lines);
+	report(os, "MappedFile + SSE2 scan", seconds([&] {
+		MappedFile file(path);
+		for_each_line(file.contents(), count);
+	}), bytes, scan_lines);
+
+	os << "  split and tokenize the first " << tokenize_lines << " lines\n";
+	auto const tokenizeBytes = [&] {
+		MappedFile file(path);
+		auto const text = file.contents();
+		char const* p = text.data();
+		for (std::size_t i = 0; i < tokenize_lines; ++i)
+			p = find_newline(p, text.data() + text.size()) + 1;
+		return static_cast<std::size_t>(p - text.data());
+	}();
+	report(os, "getline(ifstream)", seconds([&] {
+		Tokenizer tokenizer;
+		std::ifstream in(path, std::ios::binary);
+		std::string line;
+		for (std::size_t i = 0; i < tokenize_lines && std::getline(in, line); ++i)
+			total += tokenizer.tokenize(line).size();
+	}), tokenizeBytes, tokenize_lines);
+	report(os, "MappedFile + SSE2 scan", seconds([&] {
+		Tokenizer tokenizer;
+		MappedFile file(path);
+		std::size_t i = 0;
+		for_each_line(file.contents().substr(0, tokenizeBytes), [&](std::string_view line) {
+			total += tokenizer.tokenize(line).size();
+			++i;
+		});
+	}), tokenizeBytes, tokenize_lines);
+
+	std::filesystem::remove(path);
+	if (total == 0)
+		os << "  (no input)\n";
+}
@@ -0,0 +1,65 @@
+/*! \file	bench_compiled.cpp
+	\brief	Compares ee::compiled<> with ExpressionEvaluator.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+ExpressionEvaluator tokenizes, parses and evaluates the formula
+on every call, with the variable written into the text as a
+literal.  ee::compiled<> did all of that when the benchmark was
+built.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "benchmarks.hpp"
+#include <ee/compiled.hpp>
+#include <ee/expression_evaluator.hpp>
+
+#include <iomanip>
+#include <string>
+
+
+
+namespace {
+	template <typename Compiled>
+	void compare(std::ostream& os, std::string const& withLiteral, double x) {
+		Compiled const fn;
+		ExpressionEvaluator ee;
+		double const eeUs = bench::time_us([&] { (void)ee.evaluate(withLiteral); }, 50);
+		// vary the argument so the call cannot be hoisted out of the loop
+		volatile double sink = 0;
+		double const compiledUs = bench::time_us([&] { sink = fn(x); x += 1e-9; }, 1'000'000);
+		os << "  " << Compiled::expression() << '\n'
+			<< std::fixed << std::setprecision(3)
+			<< "    ExpressionEvaluator " << std::setw(12) << eeUs << " us\n"
+			<< "    ee::compiled        " << std::setw(12) << compiledUs << " us  (x"
+			<< std::setprecision(0) << eeUs / compiledUs << ")\n";
+	}
+}
+
+
+
+void bench_compiled(std::ostream& os) {
+	os << "\nee::compiled vs ExpressionEvaluator\n";
+	compare<ee::compiled<"x * x + 2 * x + 1">>(os, "3.25 * 3.25 + 2 * 3.25 + 1", 3.25);
+	compare<ee::compiled<"(x - 1.5) * (x + 2.25) / 7 + 3 ** 4">>(os, "(3.25 - 1.5) * (3.25 + 2.25) / 7 + 3 ** 4", 3.25);
+}
@@ -0,0 +1,76 @@
+/*! \file	bench_fast_mode.cpp
+	\brief	Compares RPNEvaluator fast mode with full precision evaluation.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Evaluates a fixed mix of expressions with fast mode off and at
+12 digits, reporting the mean time per expression and how many
+evaluations fell back to Real::value_type.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "benchmarks.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/parser.hpp>
+#include <ee/tokenizer.hpp>
+
+#include <iomanip>
+#include <vector>
+
+
+namespace {
+	char const* const expressions[] = {
+		"(1.1 + 2.2) * (3.3 - 4.4)",
+		"sqrt(2.0) * 3.5 + 1.25",
+		"exp(0.5) / ln(3.0)",
+		"sin(0.3) ** 2 + cos(0.3) ** 2",
+		"arctan(0.75) * 4",
+		"2 ** 30 + 17 * 3",
+		"max(1.5, 2.5) / 7",
+		"100000000000000000000.0 + 1.5 - 100000000000000000000.0",
+	};
+}
+
+
+
+void bench_fast_mode(std::ostream& os) {
+	os << "\nRPNEvaluator fast mode (12 digits) vs full precision\n";
+
+	// compile once so the comparison is of evaluation alone
+	std::vector<TokenList> compiled;
+	for (auto e : expressions)
+		compiled.push_back(Parser().parse(Tokenizer().tokenize(e)));
+
+	unsigned const reps = 50;
+	RPNEvaluator full;
+	double const fullUs = bench::time_us([&] { for (auto const& rpn : compiled) (void)full.evaluate(rpn); }, reps) / compiled.size();
+
+	RPNEvaluator fast;
+	fast.set_fast_mode(12);
+	double const fastUs = bench::time_us([&] { for (auto const& rpn : compiled) (void)fast.evaluate(rpn); }, reps) / compiled.size();
+
+	os << std::fixed << std::setprecision(2)
+		<< "  full precision " << std::setw(10) << fullUs << " us/expr\n"
+		<< "  fast mode      " << std::setw(10) << fastUs << " us/expr  x" << fullUs / fastUs << '\n'
+		<< "  fast " << fast.fast_count() << ", fallback " << fast.fallback_count() << '\n';
+}
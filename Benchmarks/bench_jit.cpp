@@ -0,0 +1,97 @@
+/*! \file	bench_jit.cpp
+	\brief	Compares JitFunction with the RPNEvaluator path.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Each formula is compiled once by JitFunction and called with a
+sweep of arguments.  The RPNEvaluator path evaluates the same
+postfix list with the variables replaced by Real operands of
+the same value.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "benchmarks.hpp"
+#include <ee/jit.hpp>
+#include <ee/parser.hpp>
+#include <ee/real.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/tokenizer.hpp>
+
+#include <algorithm>
+#include <iomanip>
+
+
+namespace {
+	char const* const formulas[] = {
+		"x * x * 3.5 - x / 7.25 + 1.0",
+		"sqrt(x * x + y * y) / (1.0 + exp(-x))",
+		"sin(x) * cos(y) + arctan2(y, x) ** 2",
+	};
+
+	/*! The postfix list with each Variable replaced by a Real holding its argument value. */
+	TokenList bind_arguments(TokenList const& rpn, JitFunction::variable_list const& variables, double const* args) {
+		TokenList bound;
+		for (auto const& token : rpn) {
+			auto const found = std::find(variables.begin(), variables.end(), token);
+			if (found == variables.end())
+				bound.push_back(token);
+			else
+				bound.push_back(make<Real>(Real::value_type(args[found - variables.begin()])));
+		}
+		return bound;
+	}
+}
+
+
+
+void bench_jit(std::ostream& os) {
+	os << "\nJitFunction vs RPNEvaluator\n";
+	for (auto formula : formulas) {
+		Tokenizer tokenizer;
+		auto const rpn = Parser().parse(tokenizer.tokenize(formula));
+		auto const fn = JitFunction::compile(rpn);
+		os << "  " << formula << '\n';
+		if (!fn) {
+			os << "    not compiled (unsupported platform or expression)\n";
+			continue;
+		}
+
+		double args[2] = { 0.75, -1.5 };
+		auto const bound = bind_arguments(rpn, fn->variables(), args);
+
+		RPNEvaluator full;
+		double const fullUs = bench::time_us([&] { (void)full.evaluate(bound); }, 20);
+		RPNEvaluator fast;
+		fast.set_fast_mode(12);
+		double const fastUs = bench::time_us([&] { (void)fast.evaluate(bound); }, 200);
+
+		// the call through the generated code cannot be optimized away
+		double const jitUs = bench::time_us([&] { args[0] += 1e-9; (void)(*fn)(args); }, 1'000'000);
+
+		os << std::fixed << std::setprecision(3)
+			<< "    RPNEvaluator " << std::setw(12) << fullUs << " us\n"
+			<< "    fast mode    " << std::setw(12) << fastUs << " us\n"
+			<< "    jit          " << std::setw(12) << jitUs << " us  (" << fn->code_size() << " bytes, x"
+			<< std::setprecision(0) << fullUs / jitUs << ")\n";
+	}
+}
@@ -0,0 +1,117 @@
+/*! \file	bench_main.cpp
+	\brief	Expression Evaluator benchmark suite.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+	Added the pipeline stage benchmarks, --json, --filter and --min-time.
+	Added --corpus: the stage benchmarks also time an ee-fuzz corpus.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <gats/ConsoleApp.hpp>
+#include "benchmarks.hpp"
+
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+
+namespace {
+	int usage() {
+		cerr << "usage: benchmarks [--json file] [--filter text] [--min-time seconds] [--corpus file]\n"
+				"  With --json or --filter only the pipeline stage benchmarks run; --json - writes to stdout.\n"
+				"  --corpus adds the expressions of an ee-fuzz corpus to the stage benchmarks, as \"fuzz\".\n";
+		return EXIT_FAILURE;
+	}
+
+	// The expressions of a corpus file: one per line, skipping blank lines and '#' comments.
+	bool read_corpus(string const& path, vector<string>& expressions) {
+		ifstream file(path);
+		if (!file)
+			return false;
+		for (string line; getline(file, line); ) {
+			while (!line.empty() && isspace(static_cast<unsigned char>(line.back())))
+				line.pop_back();
+			if (!line.empty() && line[0] != '#')
+				expressions.push_back(line);
+		}
+		return true;
+	}
+}
+
+
+
+MAKEAPP(benchmarks) {
+	auto const& args = get_args();
+	string jsonName, filter;
+	vector<string> fuzzCorpus;
+	double minSeconds = 0.5;
+	for (size_t i = 1; i < args.size(); ++i) {
+		if (args[i] == "--json" && i + 1 < args.size())
+			jsonName = args[++i];
+		else if (args[i] == "--filter" && i + 1 < args.size())
+			filter = args[++i];
+		else if (args[i] == "--min-time" && i + 1 < args.size()) {
+			auto const& n = args[++i];
+			if (from_chars(n.data(), n.data() + n.size(), minSeconds).ptr != n.data() + n.size() || !(minSeconds > 0))
+				return usage();
+		}
+		else if (args[i] == "--corpus" && i + 1 < args.size()) {
+			if (!read_corpus(args[++i], fuzzCorpus)) {
+				cerr << "benchmarks: cannot open " << args[i] << endl;
+				return EXIT_FAILURE;
+			}
+		}
+		else
+			return usage();
+	}
+
+	if (!jsonName.empty() || !filter.empty()) {
+		// machine-readable mode: progress to stderr, JSON to the file
+		auto const results = bench_stages(jsonName == "-" ? cerr : cout, filter, minSeconds, fuzzCorpus);
+		if (jsonName == "-")
+			bench::write_json(cout, args[0], results);
+		else if (!jsonName.empty()) {
+			ofstream json(jsonName);
+			bench::write_json(json, args[0], results);
+			if (!json) {
+				cerr << "benchmarks: cannot write " << jsonName << endl;
+				return EXIT_FAILURE;
+			}
+		}
+		return EXIT_SUCCESS;
+	}
+
+	cout << "Expression Evaluator benchmarks, (c) 2026 Garth Santor\n";
+	(void)bench_stages(cout, filter, minSeconds, fuzzCorpus);
+	bench_real_kernels(cout);
+	bench_fast_mode(cout);
+	bench_jit(cout);
+	bench_compiled(cout);
+	bench_batch_input(cout);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+/*! \file	bench_perf.cpp
+	\brief	Hardware performance counters for the benchmark suite.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Reads the CPU's counters through Linux perf_event_open(2): one
+event per counter, counting this process's user-space work on the
+calling thread.  Each event is opened on its own, so a CPU or a
+virtual machine that lacks one (LLC misses are often missing)
+still gives the others.  When the kernel multiplexes the events,
+each count is scaled by its enabled/running time.
+
+Elsewhere, or when perf_event_paranoid or a container forbids the
+counters, no event opens and the benchmarks report time alone.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "benchmarks.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+
+#if defined(__linux__)
+namespace {
+	struct EventType {
+		std::uint32_t	type;
+		std::uint64_t	config;
+	};
+
+	constexpr EventType event_types[bench::PerfCounters::events] = {
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+		{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+		{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+	};
+
+	int open_event(EventType event) {
+		perf_event_attr attr{};
+		attr.size = sizeof attr;
+		attr.type = event.type;
+		attr.config = event.config;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+	}
+}
+#endif
+
+
+
+bench::PerfCounters::PerfCounters() {
+	fds_m.fill(-1);
+#if defined(__linux__)
+	int firstError = 0;
+	for (std::size_t i = 0; i < events; ++i) {
+		fds_m[i] = open_event(event_types[i]);
+		if (fds_m[i] < 0 && firstError == 0)
+			firstError = errno;
+	}
+	if (!available())
+		status_m = std::string("hardware counters unavailable: perf_event_open: ") + std::strerror(firstError)
+			+ (firstError == EACCES || firstError == EPERM ? " (see /proc/sys/kernel/perf_event_paranoid)" : "");
+	else if (firstError != 0)
+		status_m = "some hardware counters unavailable";
+#else
+	status_m = "hardware counters unavailable: they need Linux perf_event_open";
+#endif
+}
+
+
+
+bench::PerfCounters::~PerfCounters() {
+#if defined(__linux__)
+	for (auto fd : fds_m)
+		if (fd >= 0)
+			close(fd);
+#endif
+}
+
+
+
+bool bench::PerfCounters::available() const {
+	for (auto fd : fds_m)
+		if (fd >= 0)
+			return true;
+	return false;
+}
+
+
+
+void bench::PerfCounters::start() {
+#if defined(__linux__)
+	for (auto fd : fds_m)
+		if (fd >= 0) {
+			ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif
+}
+
+
+
+bench::PerfCounters::Counts bench::PerfCounters::stop() {
+	Counts counts;
+	counts.fill(-1.0);
+#if defined(__linux__)
+	for (auto fd : fds_m)
+		if (fd >= 0)
+			ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+	for (std::size_t i = 0; i < events; ++i) {
+		std::uint64_t values[3] = {};		// value, time enabled, time running
+		if (fds_m[i] < 0 || read(fds_m[i], values, sizeof values) != static_cast<ssize_t>(sizeof values) || values[2] == 0)
+			continue;
+		counts[i] = static_cast<double>(values[0]) * (static_cast<double>(values[1]) / static_cast<double>(values[2]));
+	}
+#endif
+	return counts;
+}
+
+
+
+bench::PerfCounters& bench::perf_counters() {
+	static PerfCounters counters;
+	return counters;
+}
@@ -0,0 +1,100 @@
+/*! \file	bench_real_kernels.cpp
+	\brief	Compares the real_kernels exp/ln/atan against boost::multiprecision.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+For 100, 500 and 1000 digit cpp_dec_float types, reports the
+worst relative difference from the boost result over a fixed
+set of arguments, then the mean time per call of each path.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "benchmarks.hpp"
+#include <ee/real_kernels.hpp>
+
+#include <iomanip>
+#include <string>
+
+
+namespace {
+	char const* const arguments[] = {
+		"0.5", "1.0", "2.0", "-3.25", "100.125", "1e-30", "0.999999999999",
+		"1.0000000000000000000000001", "12345.678", "-700.5", "8.0", "1000.0", "0.001", "3.0"
+	};
+
+	template <typename T>
+	T relative_difference(T const& kernel, T const& reference) {
+		if (reference == 0)
+			return boost::multiprecision::abs(kernel);
+		return boost::multiprecision::abs(T((kernel - reference) / reference));
+	}
+
+	template <typename T>
+	void report(std::ostream& os, char const* name, T const& worst, double kernelUs, double boostUs) {
+		os << "  " << std::left << std::setw(6) << name << std::right
+			<< " max rel diff " << worst.str(3, std::ios_base::scientific)
+			<< "  kernel " << std::setw(10) << std::fixed << std::setprecision(1) << kernelUs << " us"
+			<< "  boost " << std::setw(10) << boostUs << " us"
+			<< "  x" << std::setprecision(2) << boostUs / kernelUs << '\n';
+	}
+
+	template <unsigned Digits>
+	void run(std::ostream& os, unsigned reps) {
+		using T = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<Digits, std::int32_t, void>>;
+
+		T worstExp{}, worstLog{}, worstAtan{};
+		for (auto a : arguments) {
+			T const x(a);
+			worstExp = std::max(worstExp, relative_difference(real_kernels::exp(x), T(boost::multiprecision::exp(x))));
+			if (x > 0) {
+				worstLog = std::max(worstLog, relative_difference(real_kernels::log(x), T(boost::multiprecision::log(x))));
+				worstLog = std::max(worstLog, relative_difference(real_kernels::log2(x), T(boost::multiprecision::log2(x))));
+				worstLog = std::max(worstLog, relative_difference(real_kernels::log10(x), T(boost::multiprecision::log10(x))));
+			}
+			worstAtan = std::max(worstAtan, relative_difference(real_kernels::atan(x), T(boost::multiprecision::atan(x))));
+			worstAtan = std::max(worstAtan, relative_difference(real_kernels::atan2(x, T("-0.7")), T(boost::multiprecision::atan2(x, T("-0.7")))));
+		}
+
+		T const x("0.7316");
+		T r;
+		os << Digits << " digits\n";
+		report(os, "exp", worstExp,
+			bench::time_us([&] { r = real_kernels::exp(x); }, reps),
+			bench::time_us([&] { r = boost::multiprecision::exp(x); }, reps));
+		report(os, "ln", worstLog,
+			bench::time_us([&] { r = real_kernels::log(x); }, reps),
+			bench::time_us([&] { r = boost::multiprecision::log(x); }, reps));
+		report(os, "atan", worstAtan,
+			bench::time_us([&] { r = real_kernels::atan(x); }, reps),
+			bench::time_us([&] { r = boost::multiprecision::atan(x); }, reps));
+	}
+}
+
+
+
+void bench_real_kernels(std::ostream& os) {
+	os << "\nreal_kernels vs boost::multiprecision\n";
+	run<100>(os, 200);
+	run<500>(os, 20);
+	run<1000>(os, 10);
+}
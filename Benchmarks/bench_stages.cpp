@@ -0,0 +1,264 @@
+/*! \file	bench_stages.cpp
+	\brief	Per-stage micro and macro benchmarks with JSON output.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Times each stage of the evaluator separately:
+
+	tokenize	Tokenizer::tokenize on the source text
+	parse		Parser::parse on tokenized input
+	evaluate	RPNEvaluator::evaluate on parsed RPN
+	end_to_end	ExpressionEvaluator::evaluate on the source text
+
+over four corpora:
+
+	automarker	the expressions of the AutoMarker suite that
+				evaluate without error, in suite order
+	long		synthetic long expressions: 2000-term sums,
+				deep parentheses and long function chains
+	bignum		Integer factorials, powers and quotients
+	real		Real arithmetic and transcendental functions
+
+and, given --corpus, the expressions ee-fuzz found slow:
+
+	fuzz		the corpus's expressions that evaluate without
+				error
+
+Case names are "<stage>/<corpus>"; an operation is one expression.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+	Added the fuzz corpus.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "benchmarks.hpp"
+#include <ee/expression_evaluator.hpp>
+#include <ee/parser.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/tokenizer.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <thread>
+
+
+namespace {
+	char const* const automarker[] = {
+		"@", "1000", "42", "0", "-42", "123456789012345678901234567890123456789012345678901234567890", "+42", "5!",
+		"100!", "2+3", "2-3", "2*3", "21/3", "23/3", "21%3", "23%3", "5**2", "123**123", "-7**2", "2*3+4",
+		"21/3-5", "2+3*4", "2-32/4", "4!!", "2*4!-4", "20*3-32/4", "(21+5)/(7+6)", "(5+6*7)*(4+3)/(1+(5+6*7))",
+		"(4 + 2 * 5) / (1 + 3 * 2)", "23 mod 3", "15 mod 6 * 3", "4**3**2", "(2)", "((2))", "(3+4)*5",
+		"((1+2)*3)-4*(2-3)", "(2**3)**4", "abs(4)", "abs(-4)", "1234.5678",
+		"123456789012345678901234567890123456789012345678901234567890.123456789012345678901234567890123456789012345678901234567890",
+		"e", "E", "pi", "Pi", "PI", "+42.3", "-42.3", "2.2+3.3", "2.2-3.3", "2.5*3.5", "5.5/1.1", "4.0 ** 0.5",
+		"cos(0.0)", "arccos(1.0)", "sin(0.0)", "arcsin(1.0)", "tan(0.0)", "arctan(0.0)", "abs(4.0)", "abs(-4.0)",
+		"ceil(4.3)", "ceil(-4.3)", "exp(1.0)", "floor(4.3)", "floor(-4.3)", "lb(8.0)", "ln(1.0)", "sqrt(16.0)",
+		"1.0/(1.0/32.0+1.0/48.0)", "sin(1.0)**2+cos(1.0)**2", "1+3.3", "5/2.0", "5.0/2", "true", "True", "TRUE",
+		"false", "False", "FALSE", "true and true", "true and false", "false and true", "false and false",
+		"true or true", "true or false", "false or true", "false or false", "true xor true", "true xor false",
+		"false xor true", "false xor false", "true nand true", "true nand false", "false nand true",
+		"false nand false", "true nor true", "true nor false", "false nor true", "false nor false",
+		"true xnor true", "true xnor false", "false xnor true", "false xnor false", "true == true",
+		"false == true", "true != true", "false != true", "1 == 1", "1 == 2", "1 != 1", "1 != 2", "1 < 1", "1 < 2",
+		"1 <= 1", "1 <= 2", "3 <= 2", "1 > 1", "2 > 1", "1 >= 1", "2 >= 1", "2 >= 3", "1.0 == 1.0", "1.0 == 2.0",
+		"1.0 != 1.0", "1.0 != 2.0", "1.0 < 1.0", "1.0 < 2.0", "1.0 <= 1.0", "1.0 <= 2.0", "2.01 <= 2.0",
+		"1.0 > 1.0", "2.0 > 1.0", "1.0 >= 1.0", "2.0 >= 1.0", "1.99 >= 2.0", "true and not true",
+		"true and false == not(not true or not false)", "4 < 5 and 5 == 5", "x=4", "a = true", "b = false",
+		"a and b == not(not a or not b)", "1+1", "2+2", "result(1)*result(2)"
+	};
+
+	char const* const bignum[] = {
+		"500!", "2 ** 4000 * 3 ** 2500", "123456789 ** 200 mod 1000007", "(2 ** 2000 + 1) / (2 ** 1000 - 1)",
+		"300! / 200!", "7 ** 7 ** 3", "(10 ** 300 + 7) * (10 ** 300 - 7)", "1000! mod (2 ** 61 - 1)",
+	};
+
+	char const* const real[] = {
+		"sin(1.5) ** 2 + cos(1.5) ** 2", "exp(2.5) * ln(3.5)", "sqrt(2.0) * pi", "arctan(0.75) * 4",
+		"(1.1 + 2.2) * (3.3 - 4.4) / 5.5", "lb(1024.0) + log(1000.0)", "1.0 / 3.0 + 2.0 / 7.0", "tan(0.5) / arcsin(0.5)",
+	};
+
+	[[nodiscard]] std::vector<std::string> long_expressions() {
+		std::vector<std::string> result;
+		std::string sum = "1", chain = "7", nested = "1", reals = "0.5";
+		for (int i = 2; i <= 2000; ++i)
+			sum += (i % 3 == 0 ? " - " : i % 3 == 1 ? " + " : " * ") + std::to_string(i % 97);
+		for (int i = 0; i < 100; ++i)
+			chain = "abs(" + chain + " - " + std::to_string(i) + ")";
+		for (int i = 0; i < 200; ++i)
+			nested = "(" + nested + " + " + std::to_string(i) + ")";
+		for (int i = 1; i <= 500; ++i)
+			reals += " + " + std::to_string(i) + ".25";
+		result.push_back(sum);
+		result.push_back(chain);
+		result.push_back(nested);
+		result.push_back(reals);
+		return result;
+	}
+
+	/*! The corpus's expressions that evaluate without error, evaluated in order by one evaluator. */
+	template <typename Range>
+	[[nodiscard]] std::vector<std::string> usable(Range const& expressions) {
+		std::vector<std::string> result;
+		ExpressionEvaluator evaluator;
+		for (auto const& e : expressions) {
+			try {
+				(void)evaluator.evaluate(e);
+				result.emplace_back(e);
+			}
+			catch (...) {
+			}
+		}
+		return result;
+	}
+
+	std::size_t volatile sink;
+
+	void run_corpus(std::vector<bench::Measurement>& results, std::ostream& os, std::string const& corpus,
+		std::vector<std::string> const& expressions, std::string const& filter, double minSeconds) {
+		auto const selected = [&](char const* stage) { return (std::string(stage) + "/" + corpus).find(filter) != std::string::npos; };
+		auto const report = [&](bench::Measurement m) {
+			os << "  " << std::left << std::setw(24) << m.name << std::right << std::fixed << std::setprecision(1)
+				<< std::setw(14) << m.nsPerOp << " ns/op" << std::setw(10) << m.allocsPerOp << " allocs/op"
+				<< std::setw(12) << std::setprecision(0) << m.bytesPerOp << " B/op\n";
+			if (bench::perf_counters().available()) {
+				// instructions per cycle shows whether the stage stalls; the misses show on what
+				auto const& c = m.perfPerOp;
+				os << "  " << std::setw(24) << "" << std::setprecision(0);
+				for (std::size_t i = 0; i < bench::PerfCounters::events; ++i)
+					if (c[i] >= 0)
+						os << std::setw(i < 2 ? 10 : 6) << std::setprecision(i < 2 ? 0 : 2) << c[i] << ' ' << bench::PerfCounters::names[i] << ' ';
+				if (c[bench::PerfCounters::instructions] >= 0 && c[bench::PerfCounters::cycles] > 0)
+					os << " IPC " << std::setprecision(2) << c[bench::PerfCounters::instructions] / c[bench::PerfCounters::cycles];
+				os << " /op\n";
+			}
+			results.push_back(std::move(m));
+		};
+		auto const ops = expressions.size();
+
+		// inputs for the later stages, produced by the stages before them
+		Tokenizer tokenizer;
+		std::vector<TokenList> tokens, rpn;
+		for (auto const& e : expressions)
+			tokens.push_back(tokenizer.tokenize(e));
+		for (auto const& t : tokens)
+			rpn.push_back(Parser().parse(t));
+
+		if (selected("tokenize"))
+			report(bench::measure("tokenize/" + corpus, ops, minSeconds, [&] {
+				for (auto const& e : expressions)
+					sink = tokenizer.tokenize(e).size();
+			}));
+		if (selected("parse"))
+			report(bench::measure("parse/" + corpus, ops, minSeconds, [&] {
+				Parser parser;
+				for (auto const& t : tokens)
+					sink = parser.parse(t).size();
+			}));
+		if (selected("evaluate"))
+			report(bench::measure("evaluate/" + corpus, ops, minSeconds, [&] {
+				RPNEvaluator evaluator;
+				for (auto const& r : rpn)
+					sink = evaluator.evaluate(r).use_count();
+			}));
+		if (selected("end_to_end"))
+			report(bench::measure("end_to_end/" + corpus, ops, minSeconds, [&] {
+				ExpressionEvaluator evaluator;
+				for (auto const& e : expressions)
+					sink = evaluator.evaluate(e).use_count();
+			}));
+	}
+
+	/*! A JSON string literal. */
+	[[nodiscard]] std::string quoted(std::string const& s) {
+		std::string result = "\"";
+		for (char c : s) {
+			if (c == '"' || c == '\\')
+				result += '\\';
+			if (static_cast<unsigned char>(c) < 0x20) {
+				char escape[8];
+				std::snprintf(escape, sizeof escape, "\\u%04x", c);
+				result += escape;
+			}
+			else
+				result += c;
+		}
+		return result + '"';
+	}
+}
+
+
+
+std::vector<bench::Measurement> bench_stages(std::ostream& os, std::string const& filter, double minSeconds,
+	std::vector<std::string> const& fuzzCorpus) {
+	os << "\nPipeline stages (per expression)\n";
+	if (!bench::perf_counters().status().empty())
+		os << "  (" << bench::perf_counters().status() << ")\n";
+	std::vector<bench::Measurement> results;
+	run_corpus(results, os, "automarker", usable(automarker), filter, minSeconds);
+	run_corpus(results, os, "long", usable(long_expressions()), filter, minSeconds);
+	run_corpus(results, os, "bignum", usable(bignum), filter, minSeconds);
+	run_corpus(results, os, "real", usable(real), filter, minSeconds);
+	if (!fuzzCorpus.empty())
+		run_corpus(results, os, "fuzz", usable(fuzzCorpus), filter, minSeconds);
+	return results;
+}
+
+
+
+void bench::write_json(std::ostream& os, std::string const& executable, std::vector<Measurement> const& results) {
+	char date[32];
+	auto const now = std::time(nullptr);
+	std::strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+	os << "{\n  \"context\": {\n"
+		<< "    \"date\": " << quoted(date) << ",\n"
+		<< "    \"executable\": " << quoted(executable) << ",\n"
+		<< "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#if defined(NDEBUG)
+		<< "    \"library_build_type\": \"release\"\n"
+#else
+		<< "    \"library_build_type\": \"debug\"\n"
+#endif
+		<< "  },\n  \"benchmarks\": [";
+	os << std::setprecision(6) << std::defaultfloat;
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		auto const& m = results[i];
+		os << (i == 0 ? "\n" : ",\n")
+			<< "    {\n"
+			<< "      \"name\": " << quoted(m.name) << ",\n"
+			<< "      \"run_type\": \"iteration\",\n"
+			<< "      \"iterations\": " << m.iterations << ",\n"
+			<< "      \"real_time\": " << m.nsPerOp << ",\n"
+			<< "      \"cpu_time\": " << m.cpuNsPerOp << ",\n"
+			<< "      \"time_unit\": \"ns\",\n"
+			<< "      \"items_per_second\": " << (m.nsPerOp > 0 ? 1e9 / m.nsPerOp : 0.0) << ",\n"
+			<< "      \"allocs_per_op\": " << m.allocsPerOp << ",\n"
+			<< "      \"bytes_per_op\": " << m.bytesPerOp << ",\n";
+		for (std::size_t c = 0; c < PerfCounters::events; ++c)
+			if (m.perfPerOp[c] >= 0)
+				os << "      " << quoted(PerfCounters::names[c]) << ": " << m.perfPerOp[c] << ",\n";
+		os << "      \"operations\": " << m.operations << "\n"
+			<< "    }";
+	}
+	os << "\n  ]\n}\n";
+}
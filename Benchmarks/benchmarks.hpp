@@ -0,0 +1,159 @@
+#pragma once
+/*! \file	benchmarks.hpp
+	\brief	Shared helpers for the Expression Evaluator benchmark suite.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Each benchmark is a free function that writes a short report
+to the supplied stream.  bench_main.cpp calls them in order.
+
+The stage benchmarks (bench_stages.cpp) also return Measurements,
+Google Benchmark style: each case is repeated until it has run for
+a minimum time, and reports time, heap allocations and bytes
+allocated per operation.  Allocations are counted by the global
+operator new replacements in bench_alloc.cpp.  On Linux they also
+report hardware counters per operation (bench_perf.cpp), when the
+kernel permits them.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+	Added Measurement, measure() and allocation counts for the stage benchmarks.
+	Added PerfCounters: instructions, cycles, branch and cache misses per operation.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+namespace bench {
+	/*!	Average wall-clock time, in microseconds, of 'reps' calls to 'f'. */
+	template <typename F>
+	[[nodiscard]] double time_us(F&& f, unsigned reps) {
+		auto const start = std::chrono::steady_clock::now();
+		for (unsigned i = 0; i < reps; ++i)
+			f();
+		auto const stop = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::micro>(stop - start).count() / reps;
+	}
+
+	/*! Heap allocations made by the whole program so far. */
+	struct Allocations {
+		std::uint64_t	count = 0;
+		std::uint64_t	bytes = 0;
+	};
+	[[nodiscard]] Allocations allocations();
+
+	/*!	The calling thread's hardware counters, read with Linux perf_event_open.  Counters
+		the CPU or the kernel's perf_event_paranoid setting do not allow stay closed. */
+	class PerfCounters {
+	public:
+		enum Event { instructions, cycles, branchMisses, l1dMisses, llcMisses };
+		static constexpr std::size_t events = 5;
+		static constexpr char const* names[events] = { "instructions", "cycles", "branch_misses", "l1d_misses", "llc_misses" };
+
+		/*! Event counts; negative for a counter that is not open. */
+		using Counts = std::array<double, events>;
+
+		PerfCounters();
+		~PerfCounters();
+		PerfCounters(PerfCounters const&) = delete;
+		PerfCounters& operator = (PerfCounters const&) = delete;
+
+		/*! True if at least one counter is open. */
+		[[nodiscard]] bool available() const;
+
+		/*! Why some or all counters are not open; empty if all are. */
+		[[nodiscard]] std::string const& status() const { return status_m; }
+
+		void start();
+		[[nodiscard]] Counts stop();
+
+	private:
+		std::array<int, events>	fds_m;
+		std::string				status_m;
+	};
+
+	/*! The counters shared by the benchmarks, opened on first use. */
+	[[nodiscard]] PerfCounters& perf_counters();
+
+	/*! One benchmark case: per-operation cost, over 'iterations' runs of 'operations' operations each. */
+	struct Measurement {
+		std::string		name;
+		std::uint64_t	iterations = 0;
+		std::uint64_t	operations = 0;
+		double			nsPerOp = 0;
+		double			cpuNsPerOp = 0;
+		double			allocsPerOp = 0;
+		double			bytesPerOp = 0;
+		PerfCounters::Counts	perfPerOp{ -1, -1, -1, -1, -1 };	// negative: not counted
+	};
+
+	/*!	Runs 'f', which performs 'operations' operations, once to warm up and then in
+		growing batches until 'minSeconds' of wall time have been spent in one batch. */
+	template <typename F>
+	[[nodiscard]] Measurement measure(std::string name, std::uint64_t operations, double minSeconds, F&& f) {
+		f();
+		Measurement m{ std::move(name), 0, operations };
+		auto& perf = perf_counters();
+		for (std::uint64_t iterations = 1; ; iterations *= 2) {
+			perf.start();
+			auto const before = allocations();
+			auto const cpuStart = std::clock();
+			auto const start = std::chrono::steady_clock::now();
+			for (std::uint64_t i = 0; i < iterations; ++i)
+				f();
+			auto const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			auto const cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+			auto const after = allocations();
+			auto const counts = perf.stop();
+			if (seconds >= minSeconds || iterations >= (std::uint64_t(1) << 40)) {
+				double const ops = static_cast<double>(iterations * operations);
+				m.iterations = iterations;
+				m.nsPerOp = seconds * 1e9 / ops;
+				m.cpuNsPerOp = cpuSeconds * 1e9 / ops;
+				m.allocsPerOp = static_cast<double>(after.count - before.count) / ops;
+				m.bytesPerOp = static_cast<double>(after.bytes - before.bytes) / ops;
+				for (std::size_t i = 0; i < PerfCounters::events; ++i)
+					m.perfPerOp[i] = counts[i] < 0 ? -1.0 : counts[i] / ops;
+				return m;
+			}
+		}
+	}
+
+	/*! Writes 'results' in the JSON layout of Google Benchmark's --benchmark_format=json. */
+	void write_json(std::ostream& os, std::string const& executable, std::vector<Measurement> const& results);
+}
+
+
+void bench_real_kernels(std::ostream& os);
+void bench_fast_mode(std::ostream& os);
+void bench_jit(std::ostream& os);
+void bench_compiled(std::ostream& os);
+void bench_batch_input(std::ostream& os);
+/*!	Times Tokenizer, Parser, RPNEvaluator and ExpressionEvaluator separately over each corpus,
+	and over 'fuzzCorpus' if it is not empty.  Only the cases whose names contain 'filter' run. */
+std::vector<bench::Measurement> bench_stages(std::ostream& os, std::string const& filter, double minSeconds,
+	std::vector<std::string> const& fuzzCorpus = {});
@@ -0,0 +1,122 @@
+/*! \file	perf_groups.cpp
+	\brief	Performance marks of the AutoMarker groups.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+One case per AutoMarker group, over the expressions that the
+group's marker evaluates (those that do not throw), weighted as
+the group is.  The targets are expressions per second.
+
+marker_12 has no case: result() cannot be evaluated by an
+ExpressionEvaluator.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <gats/TestApp.hpp>
+#include "perf_marker.hpp"
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_01_integer, 5.0) {
+	perf::mark(1'250'000, { "1000", "42", "0", "-42",
+		"123456789012345678901234567890123456789012345678901234567890" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_02_integer_unary, 10.0) {
+	perf::mark(400'000, { "+42", "-42", "- - 42", "+ + 42", "42!", "5!", "100!" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_03_integer_binary, 20.0) {
+	perf::mark(250'000, { "4+2", "4+2*3", "4*2+3", "2+3", "2-3", "2*3", "21/3", "23/3", "21%3", "23%3",
+		"5**2", "123**123", "-7**2", "2*3+4", "21/3-5", "2+3*4", "2-32/4", "4!!", "2*4!-4", "20*3-32/4",
+		"(21+5)/(7+6)", "(5+6*7)*(4+3)/(1+(5+6*7))", "(4 + 2 * 5) / (1 + 3 * 2)" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_04_integer_right_associative, 5.0) {
+	perf::mark(300'000, { "23 mod 3", "15 mod 6 * 3", "4**3**2", "2**3**4", "-2**8" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_05_integer_parenthesis, 5.0) {
+	perf::mark(250'000, { "(2)", "((2))", "(3+4)*5", "((1+2)*3)-4*(2-3)", "(2**3)**4" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_06_integer_function, 10.0) {
+	perf::mark(400'000, { "abs(2)", "max(2,4)", "min(2,4)", "abs(4)", "abs(-4)" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_07_real, 10.0) {
+	perf::mark(500, { "sin(2.0)", "cos(2.0)", "tan(2.0)", "pow(2.3,3.4)", "arctan2(2.1,4.2)-10.3", "arctan2(2.1,4.2-10.3)",
+		"1234.5678",
+		"123456789012345678901234567890123456789012345678901234567890.123456789012345678901234567890123456789012345678901234567890",
+		"e", "E", "pi", "Pi", "PI", "+42.3", "-42.3", "2.2+3.3", "2.2-3.3", "2.5*3.5", "5.5/1.1", "4.0 ** 0.5",
+		"cos(0.0)", "arccos(1.0)", "sin(0.0)", "arcsin(1.0)", "tan(0.0)", "arctan(0.0)", "abs(4.0)", "abs(-4.0)",
+		"ceil(4.3)", "ceil(-4.3)", "exp(1.0)", "floor(4.3)", "floor(-4.3)", "lb(8.0)", "ln(1.0)", "sqrt(16.0)",
+		"1.0/(1.0/32.0+1.0/48.0)", "sin(1.0)**2+cos(1.0)**2" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_08_mixed, 5.0) {
+	perf::mark(50'000, { "1+3.3", "5/2.0", "5.0/2" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_09_boolean, 5.0) {
+	perf::mark(500'000, { "true", "True", "TRUE", "false", "False", "FALSE",
+		"true and true", "true and false", "false and true", "false and false",
+		"true or true", "true or false", "false or true", "false or false",
+		"true xor true", "true xor false", "false xor true", "false xor false",
+		"true nand true", "true nand false", "false nand true", "false nand false",
+		"true nor true", "true nor false", "false nor true", "false nor false",
+		"true xnor true", "true xnor false", "false xnor true", "false xnor false" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_10_relational, 5.0) {
+	perf::mark(300'000, { "true == true", "false == true", "true != true", "false != true",
+		"1 == 1", "1 == 2", "1 != 1", "1 != 2", "1 < 1", "1 < 2", "1 <= 1", "1 <= 2", "3 <= 2",
+		"1 > 1", "2 > 1", "1 >= 1", "2 >= 1", "2 >= 3",
+		"1.0 == 1.0", "1.0 == 2.0", "1.0 != 1.0", "1.0 != 2.0", "1.0 < 1.0", "1.0 < 2.0", "1.0 <= 1.0", "1.0 <= 2.0", "2.01 <= 2.0",
+		"1.0 > 1.0", "2.0 > 1.0", "1.0 >= 1.0", "2.0 >= 1.0", "1.99 >= 2.0",
+		"true and not true", "true and false == not(not true or not false)", "4 < 5 and 5 == 5" });
+}
+
+
+
+GATS_TEST_CASE_ISOLATED_WEIGHTED(perf_11_integer_variable, 5.0) {
+	perf::mark(350'000, { "x=2", "y=x", "x=y", "x=4", "a = true", "b = false", "a and b == not(not a or not b)" });
+}
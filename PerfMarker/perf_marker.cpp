@@ -0,0 +1,60 @@
+/*! \file	perf_marker.cpp
+	\brief	Performance marking implementation.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include "perf_marker.hpp"
+#include <gats/TestApp.hpp>
+#include <ee/expression_evaluator.hpp>
+#include <cstdint>
+#include <iomanip>
+
+
+
+void perf::mark(double target, Expressions expressions) {
+	using clock = std::chrono::steady_clock;
+
+	ExpressionEvaluator evaluator;
+	for (auto expr : expressions)		// warm up
+		(void)evaluator.evaluate(expr);
+
+	std::uintmax_t evaluated = 0;
+	auto const start = clock::now();
+	clock::duration elapsed{};
+	do {
+		for (auto expr : expressions)
+			(void)evaluator.evaluate(expr);
+		evaluated += expressions.size();
+		elapsed = clock::now() - start;
+	} while (elapsed < sample_time);
+
+	double const rate = evaluated / std::chrono::duration<double>(elapsed).count();
+	target *= target_scale;
+	GATS_NOTE(std::fixed << std::setprecision(0) << rate << " expressions/s, target " << target
+		<< " (" << std::setprecision(1) << rate * 100.0 / target << "%)");
+
+	for (double fraction : { 0.25, 0.5, 0.75, 1.0 })
+		GATS_CHECK_MESSAGE(rate >= fraction * target,
+			std::fixed << std::setprecision(0) << rate << " expressions/s is below " << fraction * 100.0 << "% of the target");
+}
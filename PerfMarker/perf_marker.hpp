@@ -0,0 +1,55 @@
+#pragma once
+/*! \file	perf_marker.hpp
+	\brief	Performance marking: sustained throughput of an expression set.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+The throughput counterpart of the AutoMarker.  Each case takes
+the expressions of one AutoMarker group, evaluates them over and
+over for sample_time, and scores the expressions per second
+against the group's target: a quarter of the weight for each
+quarter of the target reached.
+
+The targets are set for a Release build on the reference machine;
+scale them with target_scale on another.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <chrono>
+#include <initializer_list>
+#include <string_view>
+
+
+namespace perf {
+	using Expressions = std::initializer_list<std::string_view>;
+
+	/*! How long each group is evaluated for. */
+	constexpr std::chrono::milliseconds sample_time{ 500 };
+
+	/*! Multiplies every target; below 1.0 for a slower machine. */
+	constexpr double target_scale = 1.0;
+
+	/*!	Evaluates 'expressions' in order, repeatedly, with one evaluator, and checks
+		the expressions per second against 'target'.  Call from a test case. */
+	void mark(double target, Expressions expressions);
+}
@@ -9,6 +9,13 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Added fast mode: certified double interval evaluation with fallback.
+	Added budget(): per-evaluation limits on time, Integer size and operations.
+	Added evaluate_async(), a coroutine that yields between slices of work.
+	Added stack_high_water().
+	Added set_profiler(): per-operation counts and times.
+
 Version 2021.11.01
 	C++ 20 validated
 	Changed to GATS_TEST
@@ -33,12 +40,67 @@ the program(s) have been supplied.
 =============================================================*/
 
 #include <ee/operand.hpp>
+#include <ee/evaluation_budget.hpp>
+#include <ee/async_evaluation.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <stack>
+
+class OperationProfiler;
 
 class RPNEvaluator {
 	RPNEvaluator(RPNEvaluator const&) = delete;
 	RPNEvaluator& operator = (RPNEvaluator const&) = delete;
+
+	unsigned		fastDigits_m = 0;
+	std::uint64_t	fastCount_m = 0;
+	std::uint64_t	fallbackCount_m = 0;
+	EvaluationBudget	budget_m;
+	bool			running_m = false;		// an asynchronous evaluation is in progress
+	std::size_t		stackHighWater_m = 0;
+	OperationProfiler*	profiler_m = nullptr;
+
+	using operand_stack = std::stack<Operand::pointer_type>;
+	[[nodiscard]] Operand::pointer_type fast_result(TokenList const& rpnExpression);
+	void apply(Token::pointer_type const& token, operand_stack& operandStack);
+	void profiled_apply(Token::pointer_type const& token, operand_stack& operandStack);
+	void check_result(operand_stack const& operandStack);
 public:
 	RPNEvaluator() = default;
 	[[nodiscard]] Operand::pointer_type evaluate( TokenList const& container );
 
+	/*!	evaluate() as a coroutine that suspends between slices of work (see
+		async_evaluation.hpp).  The evaluator must outlive the task, and runs one
+		evaluation at a time: evaluate() and evaluate_async() throw while a task
+		is unfinished. */
+	[[nodiscard]] EvaluationTask evaluate_async(TokenList rpnExpression, AsyncOptions options = {});
+
+	/*!	Fast mode.  When 'digits' is non-zero, each expression is first evaluated with
+		double interval arithmetic; the result is returned when the interval pins it
+		down to 'digits' significant digits (at most IntervalEvaluator::max_digits),
+		otherwise the expression is re-evaluated with Real::value_type.
+		Zero restores full precision evaluation. */
+	void set_fast_mode(unsigned digits) { fastDigits_m = digits; }
+	[[nodiscard]] unsigned fast_mode() const { return fastDigits_m; }
+
+	/*! Number of fast mode evaluations answered by the interval evaluator. */
+	[[nodiscard]] std::uint64_t fast_count() const { return fastCount_m; }
+	/*! Number of fast mode evaluations that fell back to full precision. */
+	[[nodiscard]] std::uint64_t fallback_count() const { return fallbackCount_m; }
+	void reset_fast_counts() { fastCount_m = fallbackCount_m = 0; }
+
+	/*!	Limits applied to every evaluation; nothing is limited by default.  Exceeding
+		one throws BudgetExceeded.  cancel() on it may be called from another thread. */
+	[[nodiscard]] EvaluationBudget& budget() { return budget_m; }
+	[[nodiscard]] EvaluationBudget const& budget() const { return budget_m; }
+
+	/*!	The deepest operand stack of the last evaluate(); zero when fast mode answered
+		it, or when built with EE_STATS=0. */
+	[[nodiscard]] std::size_t stack_high_water() const { return stackHighWater_m; }
+
+	/*!	Samples the operations of later evaluations into 'profiler' (see
+		operation_profiler.hpp); nullptr, the default, stops profiling.  The
+		profiler must outlive its use. */
+	void set_profiler(OperationProfiler* profiler) { profiler_m = profiler; }
+	[[nodiscard]] OperationProfiler* profiler() const { return profiler_m; }
 };
@@ -0,0 +1,173 @@
+#pragma once
+/*!	\file	async_evaluation.hpp
+	\brief	EvaluationTask and EvaluationScheduler declarations.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+C++20 coroutine support for evaluate_async() (RPNEvaluator and
+ExpressionEvaluator), so
+an application's event loop is not blocked by a long evaluation:
+
+	EvaluationScheduler& scheduler = EvaluationScheduler::this_thread();
+	auto task = evaluator.evaluate_async("100000!");
+	...
+	auto result = co_await task;		// from a coroutine, or
+	while (!task.done())				// from an event loop's idle handler
+		scheduler.run_one();
+
+An evaluation runs eagerly when evaluate_async() is called.  It
+suspends after every AsyncOptions::slice budget operations (RPN
+operations plus the steps of factorials, powers and series), and
+between the chunks of a large Integer factorial or the squarings
+of a large Integer power, by queueing itself on its scheduler.  An
+expression that fits in one slice completes inside the call, so
+co_await does not suspend and adds no latency.
+
+The scheduler resumes the queued evaluation with the highest
+priority first, in arrival order among equal priorities.  It is
+not thread safe: evaluations, their scheduler and the code that
+drives it belong to one thread.
+
+cancel() finishes a suspended evaluation at once with
+BudgetExceeded (Limit::cancelled).  Destroying an unfinished task
+abandons the evaluation.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/operand.hpp>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <utility>
+
+
+/*! Suspended evaluations, ready to be resumed in priority order. */
+class EvaluationScheduler {
+	std::multimap<int, std::coroutine_handle<>, std::greater<>> ready_m;
+
+public:
+	/*! Queues 'evaluation' to be resumed. */
+	void post(std::coroutine_handle<> evaluation, int priority);
+
+	/*! Takes 'evaluation' off the queue.  Returns false if it was not queued. */
+	bool remove(std::coroutine_handle<> evaluation);
+
+	/*! Resumes the first queued evaluation for one slice.  Returns false if none was queued. */
+	bool run_one();
+
+	/*! Resumes evaluations until none is queued.  Returns the number of slices run. */
+	std::size_t run();
+
+	[[nodiscard]] bool empty() const { return ready_m.empty(); }
+	[[nodiscard]] std::size_t size() const { return ready_m.size(); }
+
+	/*! The calling thread's scheduler, used when AsyncOptions names none. */
+	[[nodiscard]] static EvaluationScheduler& this_thread();
+};
+
+
+
+struct AsyncOptions {
+	int						priority = 0;			// larger runs first
+	std::uint64_t			slice = 10000;			// budget operations between suspensions
+	EvaluationScheduler*	scheduler = nullptr;	// nullptr for EvaluationScheduler::this_thread()
+};
+
+
+
+/*! An evaluation in progress: the coroutine returned by evaluate_async(), and an awaitable for its result. */
+class EvaluationTask {
+public:
+	struct promise_type {
+		Operand::pointer_type	result;
+		std::exception_ptr		error;
+		std::coroutine_handle<>	continuation;		// the coroutine awaiting the result
+		EvaluationScheduler*	scheduler = nullptr;
+		int						priority = 0;
+		bool					queued = false;
+		bool					cancelled = false;
+
+		[[nodiscard]] EvaluationTask get_return_object() { return EvaluationTask(handle::from_promise(*this)); }
+		[[nodiscard]] std::suspend_never initial_suspend() noexcept { return {}; }
+		[[nodiscard]] auto final_suspend() noexcept {
+			struct Resume {
+				bool await_ready() noexcept { return false; }
+				std::coroutine_handle<> await_suspend(handle finished) noexcept {
+					auto const next = finished.promise().continuation;
+					return next ? next : std::noop_coroutine();
+				}
+				void await_resume() noexcept {}
+			};
+			return Resume{};
+		}
+		void return_value(Operand::pointer_type value) { result = std::move(value); }
+		void unhandled_exception() { error = std::current_exception(); }
+	};
+	using handle = std::coroutine_handle<promise_type>;
+
+	/*! Awaited first by the coroutine body: adopts 'options' without suspending. */
+	struct Configure {
+		AsyncOptions options;
+		bool await_ready() noexcept { return false; }
+		bool await_suspend(handle self) noexcept;
+		void await_resume() noexcept {}
+	};
+
+	/*! Awaited by the coroutine body between slices: queues it on its scheduler. */
+	struct Yield {
+		handle self;
+		bool await_ready() noexcept { return false; }
+		bool await_suspend(handle evaluation) noexcept;
+		void await_resume();
+	};
+
+	EvaluationTask(EvaluationTask&& other) noexcept : handle_m(std::exchange(other.handle_m, {})) {}
+	EvaluationTask& operator = (EvaluationTask&& other) noexcept;
+	EvaluationTask(EvaluationTask const&) = delete;
+	EvaluationTask& operator = (EvaluationTask const&) = delete;
+	~EvaluationTask();
+
+	[[nodiscard]] bool done() const { return !handle_m || handle_m.done(); }
+
+	/*! The result.  Rethrows the evaluation's exception; throws std::logic_error if it is not done. */
+	[[nodiscard]] Operand::pointer_type get() const;
+
+	/*! Finishes a suspended evaluation now, with BudgetExceeded. */
+	void cancel();
+
+	[[nodiscard]] int priority() const { return handle_m ? handle_m.promise().priority : 0; }
+	/*! Changes the priority, requeueing the evaluation if it is waiting. */
+	void set_priority(int priority);
+
+	// awaitable
+	[[nodiscard]] bool await_ready() const noexcept { return done(); }
+	void await_suspend(std::coroutine_handle<> awaiting) noexcept { handle_m.promise().continuation = awaiting; }
+	[[nodiscard]] Operand::pointer_type await_resume() const { return get(); }
+
+private:
+	handle handle_m;
+	explicit EvaluationTask(handle h) : handle_m(h) {}
+};
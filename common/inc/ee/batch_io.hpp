@@ -0,0 +1,188 @@
+#pragma once
+/*!	\file	batch_io.hpp
+	\brief	Block-buffered line input and output for batch evaluation.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+for_each_line() reads a C stream in large blocks and hands out
+each line without its \n or \r\n terminator.  BufferedWriter
+collects output and writes it in large blocks, with no flush
+per line.  Used by ee22's batch mode and by BatchPipeline.
+
+For input that is already in memory (e.g. a MappedFile), the
+string_view overload of for_each_line() hands out views into the
+input without copying, and split_lines() cuts the input into
+pieces on line boundaries for parallel workers.  Line ends are
+found by find_newline(), which scans 16 bytes at a time with
+SSE2 where available and falls back to memchr() elsewhere.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+	Added find_newline(), split_lines() and for_each_line() for in-memory input.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <bit>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define EE_BATCH_IO_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+/*! Block size for batch input and output. */
+constexpr std::size_t batch_buffer_size = 1 << 20;
+
+
+/*! Accumulates output and writes it in large blocks, without per-line flushes. */
+class BufferedWriter {
+	BufferedWriter(BufferedWriter const&) = delete;
+	BufferedWriter& operator = (BufferedWriter const&) = delete;
+
+	std::FILE*	file_m;
+	std::string	buffer_m;
+	bool		failed_m = false;
+public:
+	explicit BufferedWriter(std::FILE* file) : file_m(file) { buffer_m.reserve(batch_buffer_size); }
+	~BufferedWriter() { flush(); }
+
+	void write(std::string_view text) {
+		buffer_m.append(text);
+		if (buffer_m.size() >= batch_buffer_size)
+			flush();
+	}
+
+	void flush() {
+		if (!buffer_m.empty() && std::fwrite(buffer_m.data(), 1, buffer_m.size(), file_m) != buffer_m.size())
+			failed_m = true;
+		buffer_m.clear();
+		std::fflush(file_m);
+	}
+
+	/*! True if any write failed. */
+	[[nodiscard]] bool failed() const { return failed_m; }
+};
+
+
+/*! Calls 'f' for each line of 'file', read in large blocks.  Handles \n and \r\n endings. */
+template <typename F>
+void for_each_line(std::FILE* file, F&& f) {
+	std::vector<char> block(batch_buffer_size);
+	std::string partial;
+	std::size_t n;
+	while ((n = std::fread(block.data(), 1, block.size(), file)) > 0) {
+		char const* begin = block.data();
+		char const* const end = begin + n;
+		while (auto newline = static_cast<char const*>(std::memchr(begin, '\n', end - begin))) {
+			std::string_view line(begin, newline - begin);
+			if (!partial.empty()) {
+				partial.append(line);
+				line = partial;
+			}
+			if (!line.empty() && line.back() == '\r')
+				line.remove_suffix(1);
+			f(line);
+			partial.clear();
+			begin = newline + 1;
+		}
+		partial.append(begin, end);
+	}
+	if (!partial.empty()) {
+		std::string_view line = partial;
+		if (line.back() == '\r')
+			line.remove_suffix(1);
+		f(line);
+	}
+}
+
+
+
+/*! The first '\n' in [first, last), or 'last' if there is none. */
+[[nodiscard]] inline char const* find_newline(char const* first, char const* last) {
+#if defined(EE_BATCH_IO_SSE2)
+	__m128i const newline = _mm_set1_epi8('\n');
+	for (; last - first >= 16; first += 16) {
+		auto const mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(first)), newline));
+		if (mask != 0)
+			return first + std::countr_zero(static_cast<unsigned>(mask));
+	}
+#endif
+	auto const found = static_cast<char const*>(std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+	return found ? found : last;
+}
+
+
+/*! Calls 'f' with a view of each line of 'text'.  Handles \n and \r\n endings. */
+template <typename F>
+void for_each_line(std::string_view text, F&& f) {
+	char const* begin = text.data();
+	char const* const end = begin + text.size();
+	while (begin != end) {
+		char const* const newline = find_newline(begin, end);
+		std::string_view line(begin, static_cast<std::size_t>(newline - begin));
+		if (!line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+		f(line);
+		begin = newline == end ? end : newline + 1;
+	}
+}
+
+
+/*! The number of lines in 'text', counting a final line without a terminator. */
+[[nodiscard]] inline std::size_t count_lines(std::string_view text) {
+	std::size_t count = 0;
+	char const* begin = text.data();
+	char const* const end = begin + text.size();
+	while (begin != end) {
+		begin = find_newline(begin, end);
+		if (begin != end)
+			++begin;
+		++count;
+	}
+	return count;
+}
+
+
+/*!	Splits 'text' into at most 'parts' pieces of roughly equal size, each ending
+	just after a '\n' (except possibly the last).  The pieces cover 'text' in order. */
+[[nodiscard]] inline std::vector<std::string_view> split_lines(std::string_view text, std::size_t parts) {
+	std::vector<std::string_view> pieces;
+	if (parts == 0)
+		parts = 1;
+	char const* begin = text.data();
+	char const* const end = begin + text.size();
+	for (std::size_t i = parts; begin != end; --i) {
+		char const* cut = end;
+		if (i > 1) {
+			auto const target = static_cast<std::size_t>(end - begin) / i;
+			cut = find_newline(begin + target, end);
+			if (cut != end)
+				++cut;
+		}
+		pieces.emplace_back(begin, static_cast<std::size_t>(cut - begin));
+		begin = cut;
+	}
+	return pieces;
+}
@@ -0,0 +1,79 @@
+#pragma once
+/*!	\file	batch_pipeline.hpp
+	\brief	BatchPipeline class declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Evaluates a batch file with reading, tokenizing+parsing and
+evaluating running on separate threads; the calling thread
+writes the output.  Adjacent stages are connected by bounded
+SpscQueues, so a slow stage stalls the ones before it instead
+of letting the queues grow.
+
+Each stage handles the lines strictly in input order, so the
+output order matches the input.  Variables keep their
+sequential meaning: the single parse stage owns the
+Tokenizer's variable dictionary, so every line naming 'x'
+receives the same Variable object, and the single evaluate
+stage runs the lines one at a time in order, so an assignment
+is complete before any later line reads the variable.  The
+parse stage never reads variable values.
+
+Output is one line per non-blank input line: the result, or
+'Error: line <n>: <message>'.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/expression_evaluator.hpp>
+#include <cstddef>
+#include <cstdio>
+
+
+class BatchPipeline {
+	BatchPipeline(BatchPipeline const&) = delete;
+	BatchPipeline& operator = (BatchPipeline const&) = delete;
+public:
+	static constexpr std::size_t default_queue_capacity = 1024;
+
+private:
+	ExpressionEvaluator	evaluator_m;
+	std::size_t			capacity_m;
+	std::size_t			lines_m = 0;
+	std::size_t			failures_m = 0;
+
+public:
+	/*! 'queueCapacity' is roughly the number of lines each queue can hold. */
+	explicit BatchPipeline(std::size_t queueCapacity = default_queue_capacity) : capacity_m(queueCapacity) { }
+
+	/*! Evaluates every line of 'input', writing the results to 'output'.  Returns the number of failures. */
+	std::size_t run(std::FILE* input, std::FILE* output);
+
+	/*! The evaluator whose variables persist across runs. */
+	[[nodiscard]] ExpressionEvaluator& evaluator() { return evaluator_m; }
+
+	/*! Expressions evaluated by the last run (blank lines excluded). */
+	[[nodiscard]] std::size_t lines() const { return lines_m; }
+
+	/*! Expressions that failed in the last run, plus one for an I/O error. */
+	[[nodiscard]] std::size_t failures() const { return failures_m; }
+};
@@ -0,0 +1,92 @@
+#pragma once
+/*!	\file	code_generator.hpp
+	\brief	CodeGenerator class declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Translates expressions into a self-contained C++ header with
+one inline function per expression, for formulas that are
+fixed at build time.
+
+Each expression is run through Tokenizer and Parser.  Every
+variable becomes a parameter of the generated function, in
+order of first appearance.  Variables are treated as Real.
+Sub-expressions made only of literals are folded at generation
+time by RPNEvaluator, so Integer arithmetic (truncating
+division, modulus, factorial, exact powers) keeps its exact
+semantics.  The remaining operations use the same Integer to
+Real promotion and Boolean rules as RPNEvaluator.  Type errors
+that RPNEvaluator would report at run time (e.g. factorial of
+a Real, and of a Boolean) are reported at generation time.
+
+Two type mappings are available:
+	native			long long, double and bool, with <cmath>.
+	multiprecision	cpp_int and cpp_dec_float<1000>, the
+					types used by Integer and Real.
+
+Division by zero throws std::runtime_error at run time in both
+mappings, as it does in RPNEvaluator.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/token.hpp>
+#include <string>
+#include <vector>
+
+
+class CodeGenerator {
+public:
+	using string_type = Token::string_type;
+
+	enum class Types { native, multiprecision };
+
+	/*! A translated expression. */
+	struct Function {
+		string_type					name;
+		string_type					expression;
+		std::vector<string_type>	parameters;
+		string_type					body;
+	};
+
+private:
+	Types					types_m;
+	std::vector<Function>	functions_m;
+	std::vector<string_type> constants_m;
+
+public:
+	explicit CodeGenerator(Types types = Types::native) : types_m(types) { }
+
+	[[nodiscard]] Types types() const { return types_m; }
+
+	/*!	Translates 'expression' into a function called 'name'.
+		Throws std::runtime_error when the name is not a C++ identifier, the
+		expression does not parse, or it uses something that cannot be compiled
+		(assignment, result(), or an operation on the wrong operand type). */
+	Function const& add(string_type const& name, string_type const& expression);
+
+	/*! The functions added so far. */
+	[[nodiscard]] std::vector<Function> const& functions() const { return functions_m; }
+
+	/*! The complete header, with the functions in namespace 'ns'. */
+	[[nodiscard]] string_type header(string_type const& ns = "ee_compiled") const;
+};
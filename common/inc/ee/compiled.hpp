@@ -0,0 +1,574 @@
+#pragma once
+/*!	\file	compiled.hpp
+	\brief	ee::compiled<> - expressions tokenized and parsed at compile time.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+For formulas known when the program is built:
+
+	constexpr ee::compiled<"x*x + 2*x + 1"> f;
+	double y = f(3.0);				// 16
+	static_assert(ee::compiled<"7/2 + 2**10">{}() == 1027);
+
+The expression is tokenized and parsed (shunting yard) by
+constexpr code, the result is a tree of nodes stored in a
+static constexpr member, and operator() expands into straight
+line code through 'if constexpr'.  No Tokenizer, Parser or
+RPNEvaluator is involved at run time.
+
+Supported: Integer and Real literals, variables, pi, e, unary
++ and -, postfix !, + - * / % mod ** with the precedence and
+associativity of Parser (so ! binds less tightly than **, and
+2**3! is (2**3)!), parentheses, and the functions abs, max, min
+and pow.  Anything else (booleans, relational
+operators, assignment, result(), the transcendental functions)
+is a compile-time error.
+
+Semantics follow RPNEvaluator for this set:
+	- Integer op Integer stays Integer: '/' truncates, '%' and
+	  '!' require Integers, '**' with a negative exponent gives
+	  a Real.
+	- Any Real operand promotes the operation to Real.
+	- Variables are Real; the call operator takes one value per
+	  variable, in order of first appearance.
+	- Division by zero is a compile-time error when both
+	  operands are constants and throws std::runtime_error at
+	  run time otherwise.
+Integers are long long and Reals are double, so Integer
+overflow is reported as a compile-time error instead of
+growing, and Real results are rounded to double precision.
+
+Every sub-expression without variables is folded at compile
+time, except a Real raised to a non-integral constant power,
+which is left to std::pow.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+
+namespace ee {
+	namespace detail {
+		/*! A string literal usable as a template argument. */
+		template <std::size_t N>
+		struct fixed_string {
+			char value[N]{};
+
+			constexpr fixed_string(char const (&s)[N]) {
+				for (std::size_t i = 0; i < N; ++i)
+					value[i] = s[i];
+			}
+
+			[[nodiscard]] constexpr std::size_t size() const { return N - 1; }
+			[[nodiscard]] constexpr std::string_view view() const { return std::string_view(value, N - 1); }
+		};
+
+
+		/*! Token and node kinds.  The order within the operators is not significant. */
+		enum class Op : unsigned char {
+			integer, real, variable,
+			identity, negation, factorial,
+			addition, subtraction, multiplication, division, modulus, power,
+			abs, max, min, pow,
+			left_parenthesis, right_parenthesis, separator
+		};
+
+		/*! Precedence categories, as in operator.hpp. */
+		enum class Prec : unsigned char { none, additive, multiplicative, unary, power };
+
+		/*! A token during parsing, and later a node of the expression tree. */
+		struct Node {
+			Op			op = Op::integer;
+			bool		integer = true;		// the value is an Integer (otherwise a Real)
+			bool		constant = true;	// folded at compile time
+			long long	i = 0;
+			double		r = 0;
+			int			variable = -1;
+			int			lhs = -1;
+			int			rhs = -1;
+		};
+
+		/*!	Reports an error in a compiled expression.  Reached during constant
+			evaluation it makes the program ill-formed, with this line in the diagnostic. */
+		[[noreturn]] inline void compile_error(char const* message) { throw std::invalid_argument(message); }
+
+		[[nodiscard]] constexpr bool is_digit(char c) { return c >= '0' && c <= '9'; }
+		[[nodiscard]] constexpr bool is_alpha(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+		[[nodiscard]] constexpr bool is_space(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+
+		[[nodiscard]] constexpr Prec precedence(Op op) {
+			switch (op) {
+			case Op::addition: case Op::subtraction:							return Prec::additive;
+			case Op::multiplication: case Op::division: case Op::modulus:		return Prec::multiplicative;
+			case Op::identity: case Op::negation: case Op::factorial:			return Prec::unary;	// Factorial is a UnaryOperator
+			case Op::power:														return Prec::power;
+			default:															return Prec::none;
+			}
+		}
+		[[nodiscard]] constexpr bool is_operator(Op op) { return precedence(op) != Prec::none; }
+		[[nodiscard]] constexpr bool is_function(Op op) { return op == Op::abs || op == Op::max || op == Op::min || op == Op::pow; }
+		[[nodiscard]] constexpr bool is_left_associative(Op op) {
+			auto const p = precedence(op);
+			return p == Prec::additive || p == Prec::multiplicative;
+		}
+		[[nodiscard]] constexpr bool is_binary(Op op) {
+			return op == Op::addition || op == Op::subtraction || op == Op::multiplication || op == Op::division
+				|| op == Op::modulus || op == Op::power || op == Op::max || op == Op::min || op == Op::pow;
+		}
+
+		/*! Case forms accepted by Tokenizer: lower, Capitalized and UPPER. */
+		[[nodiscard]] constexpr bool is_keyword(std::string_view ident, std::string_view lower) {
+			if (ident.size() != lower.size())
+				return false;
+			bool asLower = true, asCapital = true, asUpper = true;
+			for (std::size_t i = 0; i < lower.size(); ++i) {
+				char const upper = static_cast<char>(lower[i] - 'a' + 'A');
+				asLower = asLower && ident[i] == lower[i];
+				asCapital = asCapital && ident[i] == (i == 0 ? upper : lower[i]);
+				asUpper = asUpper && ident[i] == upper;
+			}
+			return asLower || asCapital || asUpper;
+		}
+
+		[[nodiscard]] constexpr long long checked_add(long long a, long long b) {
+			if ((b > 0 && a > std::numeric_limits<long long>::max() - b) || (b < 0 && a < std::numeric_limits<long long>::min() - b))
+				compile_error("Integer overflow; ee::compiled Integers are limited to long long.");
+			return a + b;
+		}
+		[[nodiscard]] constexpr long long checked_mul(long long a, long long b) {
+			constexpr auto max = std::numeric_limits<long long>::max(), min = std::numeric_limits<long long>::min();
+			bool const overflow = a > 0
+				? (b > 0 ? a > max / b : b < min / a)
+				: (b > 0 ? a < min / b : a != 0 && b < max / a);
+			if (overflow)
+				compile_error("Integer overflow; ee::compiled Integers are limited to long long.");
+			return a * b;
+		}
+
+		/*! x^n by repeated squaring. */
+		template <typename T>
+		[[nodiscard]] constexpr T power(T x, unsigned long long n, T (*mul)(T, T)) {
+			T result = 1;
+			for (; n > 0; n >>= 1) {
+				if (n & 1) result = mul(result, x);
+				if (n > 1) x = mul(x, x);
+			}
+			return result;
+		}
+		[[nodiscard]] constexpr double real_mul(double a, double b) { return a * b; }
+
+		[[nodiscard]] constexpr double as_real(Node const& n) { return n.integer ? static_cast<double>(n.i) : n.r; }
+
+
+		/*! The parsed form of an expression of at most N - 1 characters. */
+		template <std::size_t N>
+		struct Program {
+			std::array<Node, N>			nodes{};
+			std::array<std::size_t, N>	nameStart{};
+			std::array<std::size_t, N>	nameLength{};
+			int							size = 0;
+			int							variables = 0;
+			int							root = -1;
+		};
+
+
+		/*! Tokenizes, parses and folds 'text'.  Mirrors Tokenizer, Parser and RPNEvaluator. */
+		template <std::size_t N>
+		[[nodiscard]] constexpr Program<N> compile(std::string_view text) {
+			Program<N> program;
+
+			// tokenize
+			std::array<Node, N> tokens{};
+			int tokenCount = 0;
+			auto const afterOperand = [&]() {
+				if (tokenCount == 0)
+					return false;
+				auto const op = tokens[tokenCount - 1].op;
+				return op == Op::integer || op == Op::real || op == Op::variable || op == Op::factorial || op == Op::right_parenthesis;
+			};
+			auto const push = [&](Op op) { Node t; t.op = op; tokens[tokenCount++] = t; };
+
+			for (std::size_t pos = 0; pos < text.size(); ) {
+				char const c = text[pos];
+				if (is_space(c)) {
+					++pos;
+				}
+				else if (is_digit(c)) {
+					Node t;
+					unsigned long long mantissa = 0;
+					int scale = 0;
+					for (; pos < text.size() && is_digit(text[pos]); ++pos) {
+						if (mantissa > (static_cast<unsigned long long>(std::numeric_limits<long long>::max()) - (text[pos] - '0')) / 10)
+							compile_error("Integer literal too large; ee::compiled Integers are limited to long long.");
+						mantissa = mantissa * 10 + (text[pos] - '0');
+					}
+					if (pos < text.size() && text[pos] == '.') {
+						t.op = Op::real;
+						t.integer = false;
+						for (++pos; pos < text.size() && is_digit(text[pos]); ++pos)
+							if (mantissa < 100000000000000000ULL) {
+								mantissa = mantissa * 10 + (text[pos] - '0');
+								--scale;
+							}
+						// exact for up to 15 significant digits
+						double r = static_cast<double>(mantissa);
+						for (; scale < 0; ++scale)
+							r /= 10;
+						t.r = r;
+					}
+					else {
+						t.op = Op::integer;
+						t.i = static_cast<long long>(mantissa);
+					}
+					tokens[tokenCount++] = t;
+				}
+				else if (is_alpha(c)) {
+					std::size_t const start = pos;
+					while (pos < text.size() && (is_alpha(text[pos]) || is_digit(text[pos])))
+						++pos;
+					auto const ident = text.substr(start, pos - start);
+
+					if (is_keyword(ident, "abs"))		push(Op::abs);
+					else if (is_keyword(ident, "max"))	push(Op::max);
+					else if (is_keyword(ident, "min"))	push(Op::min);
+					else if (is_keyword(ident, "pow"))	push(Op::pow);
+					else if (is_keyword(ident, "mod"))	push(Op::modulus);
+					else if (is_keyword(ident, "pi") || is_keyword(ident, "e")) {
+						Node t;
+						t.op = Op::real;
+						t.integer = false;
+						t.r = is_keyword(ident, "pi") ? 3.141592653589793238462643383279502884 : 2.718281828459045235360287471352662498;
+						tokens[tokenCount++] = t;
+					}
+					else if (is_keyword(ident, "and") || is_keyword(ident, "arccos") || is_keyword(ident, "arcsin")
+						|| is_keyword(ident, "arctan") || is_keyword(ident, "arctan2") || is_keyword(ident, "ceil") || is_keyword(ident, "cos")
+						|| is_keyword(ident, "exp") || is_keyword(ident, "false") || is_keyword(ident, "floor")
+						|| is_keyword(ident, "lb") || is_keyword(ident, "ln") || is_keyword(ident, "log")
+						|| is_keyword(ident, "nand") || is_keyword(ident, "nor") || is_keyword(ident, "not")
+						|| is_keyword(ident, "or") || is_keyword(ident, "result") || is_keyword(ident, "sin")
+						|| is_keyword(ident, "sqrt") || is_keyword(ident, "tan") || is_keyword(ident, "true")
+						|| is_keyword(ident, "xnor") || is_keyword(ident, "xor"))
+						compile_error("Keyword not supported by ee::compiled.");
+					else {
+						Node t;
+						t.op = Op::variable;
+						t.integer = false;
+						t.constant = false;
+						for (int v = 0; v < program.variables && t.variable < 0; ++v)
+							if (text.substr(program.nameStart[v], program.nameLength[v]) == ident)
+								t.variable = v;
+						if (t.variable < 0) {
+							t.variable = program.variables++;
+							program.nameStart[t.variable] = start;
+							program.nameLength[t.variable] = ident.size();
+						}
+						tokens[tokenCount++] = t;
+					}
+				}
+				else if (c == '*' && pos + 1 < text.size() && text[pos + 1] == '*') {
+					push(Op::power);
+					pos += 2;
+				}
+				else {
+					++pos;
+					switch (c) {
+					case '*': push(Op::multiplication); break;
+					case '/': push(Op::division); break;
+					case '%': push(Op::modulus); break;
+					case '(': push(Op::left_parenthesis); break;
+					case ')': push(Op::right_parenthesis); break;
+					case ',': push(Op::separator); break;
+					case '+': push(afterOperand() ? Op::addition : Op::identity); break;
+					case '-': push(afterOperand() ? Op::subtraction : Op::negation); break;
+					case '!':
+						if (pos < text.size() && text[pos] == '=')
+							compile_error("Relational operators are not supported by ee::compiled.");
+						if (!afterOperand())
+							compile_error("Bad character in expression.");
+						push(Op::factorial);
+						break;
+					case '<': case '>': case '=':
+						compile_error("Relational operators and assignment are not supported by ee::compiled.");
+					default:
+						compile_error("Bad character in expression.");
+					}
+				}
+			}
+
+			// shunting yard, as Parser::parse
+			std::array<Node, N> output{};
+			std::array<Node, N> operators{};
+			int outputCount = 0, operatorCount = 0;
+			for (int t = 0; t < tokenCount; ++t) {
+				auto const& token = tokens[t];
+				if (token.op == Op::integer || token.op == Op::real || token.op == Op::variable) {
+					output[outputCount++] = token;
+				}
+				else if (is_operator(token.op)) {
+					while (operatorCount > 0 && is_operator(operators[operatorCount - 1].op)) {
+						auto const top = operators[operatorCount - 1].op;
+						bool const higher = precedence(top) > precedence(token.op);
+						bool const equal = precedence(top) == precedence(token.op);
+						if (higher || (is_left_associative(top) && equal))
+							output[outputCount++] = operators[--operatorCount];
+						else
+							break;
+					}
+					operators[operatorCount++] = token;
+				}
+				else if (is_function(token.op) || token.op == Op::left_parenthesis) {
+					operators[operatorCount++] = token;
+				}
+				else if (token.op == Op::right_parenthesis) {
+					while (operatorCount > 0 && operators[operatorCount - 1].op != Op::left_parenthesis)
+						output[outputCount++] = operators[--operatorCount];
+					if (operatorCount == 0)
+						compile_error("Mismatched parentheses");
+					--operatorCount;
+					if (operatorCount > 0 && is_function(operators[operatorCount - 1].op))
+						output[outputCount++] = operators[--operatorCount];
+				}
+				else {	// argument separator
+					while (operatorCount > 0 && operators[operatorCount - 1].op != Op::left_parenthesis)
+						output[outputCount++] = operators[--operatorCount];
+					if (operatorCount == 0)
+						compile_error("Mismatched parentheses or misplaced argument separator");
+				}
+			}
+			while (operatorCount > 0) {
+				if (operators[operatorCount - 1].op == Op::left_parenthesis)
+					compile_error("Mismatched parentheses");
+				output[outputCount++] = operators[--operatorCount];
+			}
+
+			// build the tree from the RPN, folding constant sub-expressions as RPNEvaluator would compute them
+			std::array<int, N> stack{};
+			int depth = 0;
+			for (int t = 0; t < outputCount; ++t) {
+				Node node = output[t];
+				if (node.op == Op::integer || node.op == Op::real || node.op == Op::variable) {
+					program.nodes[program.size] = node;
+					stack[depth++] = program.size++;
+					continue;
+				}
+
+				int const arity = is_binary(node.op) ? 2 : 1;
+				if (depth < arity)
+					compile_error("Error: insufficient operands");
+				node.rhs = stack[--depth];
+				if (arity == 2)
+					node.lhs = stack[--depth];
+				else
+					node.lhs = node.rhs, node.rhs = -1;
+
+				auto const& a = program.nodes[node.lhs];
+				Node const b = arity == 2 ? program.nodes[node.rhs] : Node{};
+				bool const integers = a.integer && (arity == 1 || b.integer);
+				node.constant = a.constant && (arity == 1 || b.constant);
+				node.integer = integers;
+
+				switch (node.op) {
+				case Op::identity:
+					stack[depth++] = node.lhs;
+					continue;
+				case Op::negation:
+					if (node.constant) {
+						if (a.integer) node.i = checked_mul(a.i, -1);
+						else node.r = -a.r;
+					}
+					break;
+				case Op::factorial:
+					if (!a.integer)
+						compile_error("Invalid operand type: factorial requires an Integer operand.");
+					if (a.i < 0)
+						compile_error("Factorial is not defined for negative integers.");
+					node.i = 1;
+					for (long long k = 2; k <= a.i; ++k)
+						node.i = checked_mul(node.i, k);
+					break;
+				case Op::addition: case Op::subtraction: case Op::multiplication:
+					if (node.constant) {
+						if (integers)
+							node.i = node.op == Op::addition ? checked_add(a.i, b.i)
+								: node.op == Op::subtraction ? checked_add(a.i, checked_mul(b.i, -1))
+								: checked_mul(a.i, b.i);
+						else
+							node.r = node.op == Op::addition ? as_real(a) + as_real(b)
+								: node.op == Op::subtraction ? as_real(a) - as_real(b)
+								: as_real(a) * as_real(b);
+					}
+					break;
+				case Op::division:
+					if (node.constant) {
+						if (as_real(b) == 0)
+							compile_error("Division by zero");
+						if (integers) {
+							if (a.i == std::numeric_limits<long long>::min() && b.i == -1)
+								compile_error("Integer overflow; ee::compiled Integers are limited to long long.");
+							node.i = a.i / b.i;
+						}
+						else
+							node.r = as_real(a) / as_real(b);
+					}
+					break;
+				case Op::modulus:
+					if (!integers)
+						compile_error("Invalid operand type: modulus requires Integer operands.");
+					if (b.i == 0)
+						compile_error("Division by zero");
+					node.i = b.i == -1 ? 0 : a.i % b.i;
+					break;
+				case Op::power: case Op::pow:
+					if (integers) {
+						if (b.i >= 0)
+							node.i = power<long long>(a.i, static_cast<unsigned long long>(b.i), checked_mul);
+						else if (node.op == Op::pow)
+							compile_error("pow() with a negative Integer exponent is not supported.");
+						else {
+							node.integer = false;
+							auto const magnitude = b.i == std::numeric_limits<long long>::min() ? std::numeric_limits<unsigned long long>::max() : static_cast<unsigned long long>(-b.i);
+							node.r = 1.0 / power<double>(static_cast<double>(a.i), magnitude, real_mul);
+						}
+					}
+					else if (node.constant) {
+						if (b.integer && b.i >= 0)
+							node.r = power<double>(as_real(a), static_cast<unsigned long long>(b.i), real_mul);
+						else if (b.integer)
+							node.r = 1.0 / power<double>(as_real(a), static_cast<unsigned long long>(-(b.i + 1)) + 1, real_mul);
+						else
+							node.constant = false;	// non-integral exponent: std::pow at run time
+					}
+					break;
+				case Op::abs:
+					if (node.constant) {
+						if (a.integer) node.i = a.i < 0 ? checked_mul(a.i, -1) : a.i;
+						else node.r = a.r < 0 ? -a.r : a.r;
+					}
+					break;
+				case Op::max: case Op::min:
+					if (node.constant) {
+						bool const first = node.op == Op::max ? !(as_real(a) < as_real(b)) : !(as_real(b) < as_real(a));
+						if (integers) node.i = first ? a.i : b.i;
+						else node.r = first ? as_real(a) : as_real(b);
+					}
+					break;
+				default:
+					compile_error("Unsupported operation.");
+				}
+
+				if (node.constant)
+					node.op = node.integer ? Op::integer : Op::real;
+				program.nodes[program.size] = node;
+				stack[depth++] = program.size++;
+			}
+
+			if (depth != 1)
+				compile_error(depth == 0 ? "Error: insufficient operands" : "Error: too many operands");
+			program.root = stack[0];
+			return program;
+		}
+	}
+
+
+
+	/*!	An expression compiled into the program.  The call operator takes one
+		arithmetic value per variable, in order of first appearance. */
+	template <detail::fixed_string Expression>
+	class compiled {
+		static constexpr auto program_ = detail::compile<Expression.size() + 1>(Expression.view());
+		static constexpr detail::Node root_ = program_.nodes[program_.root];
+
+	public:
+		/*! long long for Integer results, double for Real results. */
+		using result_type = std::conditional_t<root_.integer, long long, double>;
+
+		/*! Number of variables, i.e. of arguments to the call operator. */
+		static constexpr std::size_t arity = static_cast<std::size_t>(program_.variables);
+
+		/*! True when the whole expression was folded at compile time. */
+		static constexpr bool is_constant = root_.constant;
+
+		[[nodiscard]] static constexpr std::string_view expression() { return Expression.view(); }
+
+		/*! Name of the i'th variable. */
+		[[nodiscard]] static constexpr std::string_view variable(std::size_t i) {
+			return expression().substr(program_.nameStart[i], program_.nameLength[i]);
+		}
+
+		template <typename... Args>
+			requires (sizeof...(Args) == arity && (std::is_arithmetic_v<Args> && ...))
+		[[nodiscard]] constexpr result_type operator () (Args... args) const {
+			double const values[arity == 0 ? 1 : arity] = { static_cast<double>(args)... };
+			return static_cast<result_type>(eval<program_.root>(values));
+		}
+
+	private:
+		template <int I>
+		[[nodiscard]] static constexpr auto eval([[maybe_unused]] double const* values) {
+			constexpr detail::Node node = program_.nodes[I];
+			using detail::Op;
+
+			if constexpr (node.constant) {
+				if constexpr (node.integer)
+					return node.i;
+				else
+					return node.r;
+			}
+			else if constexpr (node.op == Op::variable) {
+				return values[node.variable];
+			}
+			else if constexpr (node.op == Op::negation) {
+				return -eval<node.lhs>(values);
+			}
+			else if constexpr (node.op == Op::abs) {
+				double const x = eval<node.lhs>(values);
+				return x < 0 ? -x : x;
+			}
+			else {
+				// every remaining node has at least one variable operand, so it is Real
+				double const a = static_cast<double>(eval<node.lhs>(values));
+				double const b = static_cast<double>(eval<node.rhs>(values));
+				if constexpr (node.op == Op::addition)			return a + b;
+				else if constexpr (node.op == Op::subtraction)		return a - b;
+				else if constexpr (node.op == Op::multiplication)	return a * b;
+				else if constexpr (node.op == Op::division) {
+					if (b == 0)
+						throw std::runtime_error("Division by zero");
+					return a / b;
+				}
+				else if constexpr (node.op == Op::max)	return a < b ? b : a;
+				else if constexpr (node.op == Op::min)	return b < a ? b : a;
+				else {
+					static_assert(node.op == Op::power || node.op == Op::pow);
+					return std::pow(a, b);
+				}
+			}
+		}
+	};
+}
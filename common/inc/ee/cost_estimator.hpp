@@ -0,0 +1,75 @@
+#pragma once
+/*!	\file	cost_estimator.hpp
+	\brief	CostEstimator class declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Estimates, without evaluating it, how long an RPN token list
+will take.  The stack is simulated with operand sizes instead of
+values: Integer literals and variables contribute their bit
+length, Reals the working precision.  Each operation adds a cost
+from a model fitted to measurements of the evaluator at 1000
+digits:
+
+	transcendental function		1.3 ms (exp) to 12.5 ms (sin)
+	Real power, non-integer		about 100 ms
+	n!							1.5e-4 n^2 us
+	Integer a ** b				result limbs^2 x 1.3e-4 us
+	Integer * and /				limb products x 4e-4 and 6.5e-3 us
+
+Real costs scale with the square of the precision.  Exponents
+and factorial arguments are taken from literals or from the
+variable's current value; an unknown one is assumed to be as
+large as its bit length allows.  The result is an order of
+magnitude, good enough to keep cheap requests away from
+expensive ones.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/token.hpp>
+
+
+class CostEstimator {
+public:
+	struct Cost {
+		double		microseconds = 0;		// estimated evaluation time
+		unsigned	transcendentals = 0;	// trigonometric, exponential and logarithmic calls
+		double		largestBits = 0;		// largest Integer operand or result, in bits
+		double		largestFactorial = 0;	// largest factorial argument
+		double		largestExponent = 0;	// largest power exponent
+	};
+
+	/*! Working precision of Real, in decimal digits. */
+	static constexpr unsigned default_digits = 1000;
+
+	/*! 'digits' is the Real precision the evaluator works at. */
+	explicit CostEstimator(unsigned digits = default_digits) : digits_m(digits) {}
+
+	[[nodiscard]] unsigned digits() const { return digits_m; }
+
+	/*! The estimated cost of evaluating 'rpnExpression'.  Never throws for malformed input. */
+	[[nodiscard]] Cost estimate(TokenList const& rpnExpression) const;
+
+private:
+	unsigned digits_m;
+};
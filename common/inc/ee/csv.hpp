@@ -0,0 +1,166 @@
+#pragma once
+/*!	\file	csv.hpp
+	\brief	CSV field splitting and number recognition.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+The small CSV dialect shared by CsvEvaluator and the EECOL
+converter: fields are separated by commas and may be enclosed
+in double quotes (a doubled quote inside stays doubled);
+spaces, tabs and carriage returns around a field are ignored.
+The first non-blank line is the header.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/batch_io.hpp>
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace csv {
+	[[nodiscard]] inline std::string_view trim(std::string_view s) {
+		while (!s.empty() && (s.front() == ' ' || s.front() == '\t' || s.front() == '\r'))
+			s.remove_prefix(1);
+		while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r'))
+			s.remove_suffix(1);
+		return s;
+	}
+
+	/*! Splits 'line' into 'fields', removing enclosing double quotes. */
+	inline void split_fields(std::string_view line, std::vector<std::string_view>& fields) {
+		fields.clear();
+		std::size_t pos = 0;
+		for (;;) {
+			while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t'))
+				++pos;
+			if (pos < line.size() && line[pos] == '"') {
+				auto close = pos + 1;
+				while (close < line.size() && !(line[close] == '"' && (close + 1 == line.size() || line[close + 1] != '"')))
+					close += line[close] == '"' ? 2 : 1;
+				fields.push_back(line.substr(pos + 1, close - pos - 1));
+				pos = line.find(',', close);
+			}
+			else {
+				auto const comma = line.find(',', pos);
+				fields.push_back(trim(line.substr(pos, comma == std::string_view::npos ? std::string_view::npos : comma - pos)));
+				pos = comma;
+			}
+			if (pos == std::string_view::npos)
+				break;
+			++pos;
+		}
+	}
+
+	/*!	Splits the header row of 'text' into 'fields' and returns the rest of the text.
+		'headerLine' receives the header's 1-based line number. */
+	[[nodiscard]] inline std::string_view split_header(std::string_view text, std::vector<std::string_view>& fields, std::size_t& headerLine) {
+		if (text.substr(0, 3) == "\xEF\xBB\xBF")
+			text.remove_prefix(3);
+		fields.clear();
+		headerLine = 0;
+		char const* next = text.data();
+		char const* const end = next + text.size();
+		while (next != end) {
+			char const* const newline = find_newline(next, end);
+			std::string_view const line(next, static_cast<std::size_t>(newline - next));
+			next = newline == end ? end : newline + 1;
+			++headerLine;
+			if (!trim(line).empty()) {
+				split_fields(line, fields);
+				break;
+			}
+		}
+		return text.substr(static_cast<std::size_t>(next - text.data()));
+	}
+
+	enum class Number { none, integer, fixed, real };
+
+	/*!	Classifies 'field': integer ([+-]digits), fixed (with a fraction, no exponent),
+		real (with an exponent) or none.  'decimals' receives the number of fraction digits. */
+	[[nodiscard]] inline Number classify(std::string_view field, std::size_t& decimals) {
+		std::size_t i = 0;
+		auto const digits = [&] {
+			auto const start = i;
+			while (i < field.size() && std::isdigit(static_cast<unsigned char>(field[i])))
+				++i;
+			return i - start;
+		};
+		decimals = 0;
+		if (i < field.size() && (field[i] == '+' || field[i] == '-'))
+			++i;
+		auto const whole = digits();
+		auto type = Number::integer;
+		if (i < field.size() && field[i] == '.') {
+			++i;
+			decimals = digits();
+			if (whole + decimals == 0)
+				return Number::none;
+			type = Number::fixed;
+		}
+		else if (whole == 0)
+			return Number::none;
+		if (i < field.size() && (field[i] == 'e' || field[i] == 'E')) {
+			++i;
+			if (i < field.size() && (field[i] == '+' || field[i] == '-'))
+				++i;
+			if (digits() == 0)
+				return Number::none;
+			type = Number::real;
+		}
+		return i == field.size() ? type : Number::none;
+	}
+
+	[[nodiscard]] inline Number classify(std::string_view field) {
+		std::size_t decimals;
+		return classify(field, decimals);
+	}
+
+	/*!	An integer field ([+-]digits, '.' ignored) as text cpp_int reads in decimal:
+		no '+' and no leading zeros, which cpp_int would take as octal. */
+	[[nodiscard]] inline std::string integer_digits(std::string_view field) {
+		std::string result;
+		for (char c : field) {
+			if (c == '-')
+				result += c;
+			else if (c >= '0' && c <= '9' && (c != '0' || (!result.empty() && result != "-")))
+				result += c;
+		}
+		if (result.empty() || result == "-")
+			return "0";
+		return result;
+	}
+
+	/*! 'text' in double quotes, with inner quotes doubled. */
+	[[nodiscard]] inline std::string quoted(std::string_view text) {
+		std::string result = "\"";
+		for (char c : text) {
+			if (c == '"')
+				result += '"';
+			result += c;
+		}
+		return result + "\"";
+	}
+}
@@ -0,0 +1,125 @@
+#pragma once
+/*!	\file	csv_evaluator.hpp
+	\brief	CsvEvaluator class declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Evaluates one formula against every row of a CSV or EECOL
+file.
+
+The formula is tokenized and parsed once.  Each variable it
+names is bound to the input column with the same name.  A CSV
+column holds Integers if every numeric field in it is an
+integer, and Reals otherwise, so a formula sees the same types
+it would see if the row had been typed in by hand.  An EECOL
+column supplies Booleans (boolean), Integers (int64, bignum) or
+Reals (float64, decimal) according to its type, with no text
+conversion.
+
+Rows are read in chunks: the fields of the bound columns in a
+chunk are parsed straight into Integer or Real operands, then
+the formula is evaluated once per row with the variables set
+to that row's operands.  Columns the formula does not use are
+never parsed.
+
+A row whose bound field is missing, null or not a number, or
+whose evaluation throws (including a BudgetExceeded under
+set_limits()), is a failure; the other rows are
+unaffected.  CSV fields follow the dialect of csv.hpp.
+
+Output formats:
+	csv		a header with the result column name, then one value
+			per row; a failure is written as a quoted
+			"Error: line <n>: <message>" (row <n> for EECOL input).
+	eecol	one column of the result type (float64 unless
+			set_result_type() says otherwise); a failure, or a
+			result that does not fit the type, is a null.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+	EECOL input and output replace the raw double output.
+	Added set_limits().
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/expression_evaluator.hpp>
+#include <ee/eecol.hpp>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+class CsvEvaluator {
+	CsvEvaluator(CsvEvaluator const&) = delete;
+	CsvEvaluator& operator = (CsvEvaluator const&) = delete;
+public:
+	enum class Format { csv, eecol };
+	enum class ColumnType { boolean, integer, real };
+
+	/*! A CSV column bound to a variable of the formula. */
+	struct Column {
+		std::string				name;
+		std::size_t				field = 0;
+		ColumnType				type = ColumnType::integer;
+		Token::pointer_type		variable;
+	};
+
+	static constexpr std::size_t chunk_rows = 4096;
+
+private:
+	ExpressionEvaluator	evaluator_m;
+	TokenList			rpn_m;
+	std::vector<Column>	columns_m;
+	EecolType			resultType_m = EecolType::float64;
+	int					resultScale_m = 0;
+	std::size_t			rows_m = 0;
+	std::size_t			failures_m = 0;
+
+	void bind(std::vector<std::string_view> const& names);
+
+public:
+	/*! Compiles 'formula'.  Throws if it does not parse. */
+	explicit CsvEvaluator(std::string_view formula);
+
+	/*!	Evaluates the formula for every row of 'csv', writing the results to 'output'.
+		Returns the number of failed rows, plus one for an output error.
+		Throws std::runtime_error if the header lacks a column the formula uses. */
+	std::size_t run(std::string_view csv, std::FILE* output, Format format = Format::csv, std::string const& resultName = "result");
+
+	/*! As above, reading the columns of an EECOL file. */
+	std::size_t run(EecolReader const& input, std::FILE* output, Format format = Format::csv, std::string const& resultName = "result");
+
+	/*! Limits applied to each row's evaluation. */
+	void set_limits(EvaluationBudget::Limits const& limits) { evaluator_m.rpn_evaluator().budget().set_limits(limits); }
+
+	/*! The type of the EECOL result column; 'scale' is for decimal. */
+	void set_result_type(EecolType type, int scale = 0) { resultType_m = type; resultScale_m = scale; }
+
+	/*! The columns bound by the last run, in input order. */
+	[[nodiscard]] std::vector<Column> const& columns() const { return columns_m; }
+
+	/*! Rows evaluated by the last run. */
+	[[nodiscard]] std::size_t rows() const { return rows_m; }
+
+	/*! Rows that failed in the last run. */
+	[[nodiscard]] std::size_t failures() const { return failures_m; }
+};
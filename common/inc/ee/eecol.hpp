@@ -0,0 +1,196 @@
+#pragma once
+/*!	\file	eecol.hpp
+	\brief	EECOL binary column file: EecolWriter and EecolReader.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+EECOL stores typed columns of evaluator inputs or results, so
+batch jobs can skip the text conversions to and from cpp_int
+and cpp_dec_float.  The file is laid out to be memory-mapped
+and read in place.  All values are little-endian.
+
+	offset	size
+	0		8	magic "EECOL\0\0\1"
+	8		4	version (1)
+	12		4	column count
+	16		8	row count
+	24		8	directory offset (64)
+	32		8	file size
+	40		24	zero
+	64		64	directory entry, one per column:
+				0	8	name offset
+				8	4	name length in bytes
+				12	1	type
+				13	1	zero
+				14	2	scale (decimal only)
+				16	8	validity bitmap offset, 0 if every row is valid
+				24	8	data offset
+				32	8	data size in bytes
+				40	8	index offset (bignum and decimal)
+				48	8	sign bitmap offset (bignum and decimal)
+				56	8	zero
+
+Every block starts on a 64-byte boundary.  Bitmaps hold one bit
+per row, least significant bit first; a clear validity bit is a
+null.  Column data by type:
+
+	boolean		bitmap
+	int64		int64_t per row
+	bignum		uint64_t limbs of the magnitudes, least significant
+				first; the index holds rows+1 uint64_t limb offsets
+				and the sign bitmap has a bit set for a negative row
+	float64		IEEE-754 double per row
+	decimal		as bignum, holding value * 10^scale exactly
+
+int64 and float64 columns can be viewed directly as arrays; the
+other types are decoded per row.  Only little-endian hosts are
+supported.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+enum class EecolType : std::uint8_t { boolean = 1, int64 = 2, bignum = 3, float64 = 4, decimal = 5 };
+
+/*! The name of 'type', e.g. "int64". */
+[[nodiscard]] char const* to_string(EecolType type);
+
+/*!	Parses a type name: boolean, int64, bignum, float64 or decimal:<scale>.
+	Throws std::runtime_error for anything else. */
+[[nodiscard]] EecolType parse_eecol_type(std::string_view text, int& scale);
+
+
+
+/*! Builds an EECOL file in memory, one value at a time per column. */
+class EecolWriter {
+	struct Column {
+		std::string					name;
+		EecolType					type;
+		int							scale = 0;
+		std::size_t					rows = 0;
+		std::vector<std::uint8_t>	validity{};
+		bool						hasNull = false;
+		std::vector<std::uint8_t>	bits{};		// boolean values, bignum/decimal signs
+		std::vector<std::int64_t>	int64s{};
+		std::vector<double>			doubles{};
+		std::vector<std::uint64_t>	limbs{};
+		std::vector<std::uint64_t>	index{ 0 };
+	};
+	std::vector<Column> columns_m;
+
+	Column& next(std::size_t column, bool valid);
+	void push_magnitude(Column& c, Integer::value_type const& value);
+
+public:
+	/*! Adds a column and returns its number.  'scale' is the number of decimal places of a decimal column. */
+	std::size_t add_column(std::string name, EecolType type, int scale = 0);
+
+	[[nodiscard]] std::size_t columns() const { return columns_m.size(); }
+
+	void push_null(std::size_t column);
+	void push_boolean(std::size_t column, bool value);
+	void push_int64(std::size_t column, std::int64_t value);
+	void push_bignum(std::size_t column, Integer::value_type const& value);
+	void push_float64(std::size_t column, double value);
+	/*! Rounds 'value' to the column's scale. */
+	void push_decimal(std::size_t column, Real::value_type const& value);
+	/*! 'text' is [+-]digits[.digits] with at most 'scale' decimal places; stored exactly. */
+	void push_decimal(std::size_t column, std::string_view text);
+
+	/*!	Converts an evaluator result to the column's type and appends it.
+		Throws std::runtime_error, appending nothing, if the value does not fit
+		(e.g. a Real into an int64 column, or an Integer beyond 64 bits). */
+	void push_operand(std::size_t column, Token::pointer_type const& value);
+
+	/*! Writes the file.  Throws std::runtime_error if the columns differ in length or the write fails. */
+	void write(std::FILE* file) const;
+};
+
+
+
+/*! A read-only view of an EECOL file held in memory, usually a MappedFile. */
+class EecolReader {
+public:
+	struct Column {
+		std::string_view		name;
+		EecolType				type;
+		int						scale = 0;
+		std::uint8_t const*		validity = nullptr;
+		std::uint8_t const*		data = nullptr;
+		std::uint64_t const*	index = nullptr;
+		std::uint8_t const*		signs = nullptr;
+	};
+
+private:
+	std::string_view	bytes_m;
+	std::size_t			rows_m = 0;
+	std::vector<Column>	columns_m;
+
+	[[nodiscard]] Integer::value_type magnitude(Column const& c, std::size_t row) const;
+	[[nodiscard]] std::string decimal_text(Column const& c, std::size_t row) const;
+
+public:
+	/*! Checks the header and directory of 'bytes'.  Throws std::runtime_error if it is not a valid EECOL file. */
+	explicit EecolReader(std::string_view bytes);
+
+	/*! True if 'bytes' starts with the EECOL magic. */
+	[[nodiscard]] static bool is_eecol(std::string_view bytes);
+
+	[[nodiscard]] std::size_t rows() const { return rows_m; }
+	[[nodiscard]] std::vector<Column> const& columns() const { return columns_m; }
+	/*! The number of the column called 'name', or columns().size() if there is none. */
+	[[nodiscard]] std::size_t find(std::string_view name) const;
+
+	[[nodiscard]] bool valid(std::size_t column, std::size_t row) const;
+	[[nodiscard]] bool boolean(std::size_t column, std::size_t row) const;
+	[[nodiscard]] std::span<std::int64_t const> int64s(std::size_t column) const;
+	[[nodiscard]] std::span<double const> float64s(std::size_t column) const;
+	[[nodiscard]] Integer::value_type bignum(std::size_t column, std::size_t row) const;
+	[[nodiscard]] Real::value_type decimal(std::size_t column, std::size_t row) const;
+
+	/*! The value as an evaluator operand (Boolean, Integer or Real), or nullptr for a null. */
+	[[nodiscard]] Operand::pointer_type operand(std::size_t column, std::size_t row) const;
+
+	/*! The value as CSV text; empty for a null.  Decimals are exact, doubles round-trip. */
+	[[nodiscard]] std::string text(std::size_t column, std::size_t row) const;
+};
+
+
+
+/*!	Converts CSV (header row, then values) to EECOL.  Each column gets the narrowest
+	type holding every non-empty field: boolean (true/false), int64, bignum, decimal
+	(no exponent; scale = most decimal places) or float64.  Empty fields are nulls.
+	Returns the names of the columns skipped because they are not numeric. */
+std::vector<std::string> csv_to_eecol(std::string_view csv, std::FILE* output);
+
+/*! Writes an EECOL file as CSV, nulls as empty fields. */
+void eecol_to_csv(EecolReader const& input, std::FILE* output);
@@ -0,0 +1,133 @@
+#pragma once
+/*!	\file	eval_server.hpp
+	\brief	EvalServer class declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A local evaluation server on a Unix domain socket, so several
+processes can share one warmed-up evaluator process.
+
+The protocol is line oriented.  Each request is one expression
+per line ('\n' or "\r\n"); blank lines are ignored.  Each request
+gets one reply line, in request order:
+
+	[n] = <result>		the session's n-th result
+	Error: <message>
+
+A request of the form '[n]' repeats the session's n-th result,
+and '#stats' is answered with one line of lane statistics.
+Clients may send any number of requests before reading the
+replies (pipelining).  A line longer than max_line_size bytes is
+answered with an error and the connection is closed once the
+replies before it are sent.
+
+Every connection is a session with its own ExpressionEvaluator,
+so variables and the result history are private to it.  A single
+epoll thread accepts connections and moves bytes; worker threads
+evaluate.  A session's requests are evaluated by one worker at a
+time, in order, while different sessions run in parallel.  A
+connection that has too many unanswered requests or unsent
+replies is not read until its client catches up.
+
+Workers are split into a cheap and an expensive lane, each with
+its own pool, so a 1000000! cannot hold up a queue of 1+1s.  The
+worker holding a session compiles its next request and prices it
+with CostEstimator; a request estimated above the threshold is
+handed to the expensive lane, and back again once the next one
+is cheap.  Within a lane, sessions are served in order of
+arrival time plus estimated cost (shortest job first, with
+waiting time counted so no job starves).  Each lane keeps the
+latencies, from arrival to reply, of its last 8192 requests.
+
+Every request runs under the server's EvaluationBudget limits,
+by default 10 seconds and 2^24-bit Integers, so one request
+cannot take a worker or the server's memory.  A session's work
+in progress is cancelled when its client disconnects or the
+server stops.
+
+Only Linux is supported (epoll); elsewhere the constructor
+throws.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+	Cheap and expensive lanes, scheduled by CostEstimator.
+	Evaluation limits; cancellation on disconnect and shutdown.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/evaluation_budget.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+
+class EvalServer {
+	struct Impl;
+	std::unique_ptr<Impl> impl_m;
+
+public:
+	enum class Lane { cheap, expensive };
+
+	/*! Latencies in microseconds, percentiles over the lane's recent requests. */
+	struct LaneStats {
+		unsigned	workers = 0;
+		std::size_t	requests = 0;
+		double		p50 = 0, p90 = 0, p99 = 0, max = 0;
+	};
+
+	static constexpr std::size_t max_line_size = 1 << 20;
+
+	/*! Estimated cost above which a request goes to the expensive lane. */
+	static constexpr double default_expensive_microseconds = 1000;
+
+	/*! Limits on every request unless set_limits() says otherwise. */
+	[[nodiscard]] static EvaluationBudget::Limits default_limits() { return { std::chrono::seconds(10), 1 << 24, 0 }; }
+
+	/*!	Listens on the Unix domain socket 'path' with 'workers' evaluation threads
+		(0 for one per hardware thread), a quarter of them, at least one, in the
+		expensive lane.  A stale socket file at 'path' is replaced.
+		Throws std::runtime_error if the socket cannot be created. */
+	explicit EvalServer(std::string const& path, unsigned workers = 0);
+	~EvalServer();
+
+	EvalServer(EvalServer const&) = delete;
+	EvalServer& operator = (EvalServer const&) = delete;
+
+	/*! Sets the lanes' pool sizes (at least one each) and threshold.  Call before run(). */
+	void set_lanes(unsigned cheapWorkers, unsigned expensiveWorkers, double expensiveMicroseconds = default_expensive_microseconds);
+
+	/*! Sets the limits on each request of the sessions opened from now on. */
+	void set_limits(EvaluationBudget::Limits const& limits);
+	[[nodiscard]] EvaluationBudget::Limits limits() const;
+
+	/*! Serves connections until stop() is called, then closes them and removes the socket file. */
+	void run();
+
+	/*! Makes run() return.  Safe to call from any thread or from a signal handler. */
+	void stop();
+
+	/*! Worker threads in both lanes. */
+	[[nodiscard]] unsigned workers() const;
+	/*! Connections accepted so far. */
+	[[nodiscard]] std::size_t connections() const;
+	/*! Requests evaluated so far (including the ones that failed). */
+	[[nodiscard]] std::size_t requests() const;
+	[[nodiscard]] LaneStats lane_stats(Lane lane) const;
+};
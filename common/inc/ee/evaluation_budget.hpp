@@ -0,0 +1,168 @@
+#pragma once
+/*!	\file	evaluation_budget.hpp
+	\brief	EvaluationBudget and BudgetExceeded declarations.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Limits on one evaluation, so untrusted input such as 10**10**10
+or 100000000! fails quickly instead of running for hours or
+exhausting memory:
+
+	time		wall time from the start of the evaluation
+	bits		bit length of any Integer operand or result
+	operations	RPN operations plus the steps of the long loops
+				(factorial multiplications, power squarings,
+				series terms)
+
+A zero limit is no limit; by default nothing is limited.
+
+RPNEvaluator owns a budget, starts it for every evaluation,
+checks it after every operation and makes it the thread's current
+budget while it runs.  Long loops
+call EvaluationBudget::checkpoint(), which charges the current
+budget (if any) and throws BudgetExceeded when a limit is passed
+or the evaluation was cancelled.  Operations whose result is
+known to be too large, e.g. a factorial or power whose bit length
+is beyond the limit, are rejected before they start.
+
+cancel() may be called from any thread.  Other calls belong to
+the evaluating thread.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+
+/*! Thrown when an evaluation runs out of its budget or is cancelled. */
+class BudgetExceeded : public std::runtime_error {
+public:
+	enum class Limit { time, bits, operations, cancelled };
+
+	BudgetExceeded(Limit limit, std::string const& message) : std::runtime_error(message), limit_m(limit) {}
+
+	[[nodiscard]] Limit limit() const { return limit_m; }
+
+private:
+	Limit limit_m;
+};
+
+
+
+class EvaluationBudget {
+public:
+	using clock = std::chrono::steady_clock;
+
+	struct Limits {
+		std::chrono::microseconds	time{ 0 };
+		std::uint64_t				bits = 0;
+		std::uint64_t				operations = 0;
+
+		[[nodiscard]] bool any() const { return time.count() != 0 || bits != 0 || operations != 0; }
+	};
+
+	/*! Makes a budget the thread's current one for its lifetime. */
+	class Scope {
+		EvaluationBudget* previous_m;
+	public:
+		explicit Scope(EvaluationBudget& budget) : previous_m(current_m) { current_m = &budget; }
+		~Scope() { current_m = previous_m; }
+		Scope(Scope const&) = delete;
+		Scope& operator = (Scope const&) = delete;
+	};
+
+	EvaluationBudget() = default;
+	explicit EvaluationBudget(Limits const& limits) : limits_m(limits) {}
+
+	[[nodiscard]] Limits const& limits() const { return limits_m; }
+	void set_limits(Limits const& limits) { limits_m = limits; }
+
+	/*! Starts a new evaluation: resets the operation count and the clock.  Throws if cancelled. */
+	void start() {
+		if (cancelled())
+			fail(BudgetExceeded::Limit::cancelled);
+		operations_m = 0;
+		if (limits_m.time.count() != 0)
+			deadline_m = clock::now() + limits_m.time;
+	}
+
+	/*! Counts 'operations' steps, checking the limits, the clock and cancellation. */
+	void charge(std::uint64_t operations = 1) {
+		operations_m += operations;
+		if (limits_m.operations != 0 && operations_m > limits_m.operations)
+			fail(BudgetExceeded::Limit::operations);
+		if (operations > 1 || (operations_m & 63) == 0)		// the clock every 64 steps
+			check();
+	}
+
+	/*! Throws if the evaluation was cancelled or is past its deadline. */
+	void check() const;
+
+	/*! Throws now if a result of 'bits' bits is over the limit. */
+	void check_bits(double bits) const {
+		if (limits_m.bits != 0 && bits > static_cast<double>(limits_m.bits))
+			fail(BudgetExceeded::Limit::bits);
+	}
+
+	/*! Throws now if 'operations' more steps would be over the limit. */
+	void check_operations(double operations) const {
+		if (limits_m.operations != 0 && static_cast<double>(operations_m) + operations > static_cast<double>(limits_m.operations))
+			fail(BudgetExceeded::Limit::operations);
+	}
+
+	/*! Steps counted since start(). */
+	[[nodiscard]] std::uint64_t operations() const { return operations_m; }
+
+	/*! Aborts the evaluation in progress, and later ones until resume().  Thread safe. */
+	void cancel() { cancelled_m.store(true, std::memory_order_relaxed); }
+	void resume() { cancelled_m.store(false, std::memory_order_relaxed); }
+	[[nodiscard]] bool cancelled() const { return cancelled_m.load(std::memory_order_relaxed); }
+
+	/*! The thread's current budget, or nullptr. */
+	[[nodiscard]] static EvaluationBudget* current() { return current_m; }
+
+	/*! Charges the current budget, if there is one. */
+	static void checkpoint(std::uint64_t operations = 1) {
+		if (current_m)
+			current_m->charge(operations);
+	}
+
+	/*! Checks the current budget's bit limit, if there is one. */
+	static void check_current_bits(double bits) {
+		if (current_m)
+			current_m->check_bits(bits);
+	}
+
+private:
+	Limits				limits_m;
+	std::uint64_t		operations_m = 0;
+	clock::time_point	deadline_m;
+	std::atomic<bool>	cancelled_m{ false };
+
+	static inline thread_local EvaluationBudget* current_m = nullptr;
+
+	[[noreturn]] void fail(BudgetExceeded::Limit limit) const;
+};
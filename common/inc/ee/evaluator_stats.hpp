@@ -0,0 +1,149 @@
+#pragma once
+/*!	\file	evaluator_stats.hpp
+	\brief	EvaluatorStats declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Per-stage timing and counters for ExpressionEvaluator, always
+available through ExpressionEvaluator::stats() (and ee's :stats
+command).  For each of lex, parse and evaluate it records the
+number of calls, the cumulative and latest nanoseconds, the
+Token objects allocated and the calls that ended in an exception.
+It also records the lexer's token counts and the operand stack
+high-water mark of the RPN evaluator.
+
+Every Token and Operand is one heap allocation, so the allocation
+counts are the evaluator's own allocations, less the internal
+buffers of big Integers and Reals.
+
+Recording costs two clock reads per stage.  Build with EE_STATS
+defined as 0 to remove it: the timers and counters compile to
+nothing, Token's constructor is defaulted and the statistics stay
+zero.  EE_STATS changes the layout of Timer and the definition of
+Token's constructor, so it must be defined the same way in every
+translation unit of the program (a project or compiler setting,
+not a #define before an #include).  MSVC's linker rejects a
+mismatch.
+
+The lex and parse figures are written by compile(), the evaluate
+figures by run(), so the two may run on different threads.  Read
+the statistics while the evaluator is idle.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <ostream>
+
+#if !defined(EE_STATS)
+#define EE_STATS 1
+#endif
+
+#if defined(_MSC_VER)
+#if EE_STATS
+#pragma detect_mismatch("EE_STATS", "1")
+#else
+#pragma detect_mismatch("EE_STATS", "0")
+#endif
+#endif
+
+
+class EvaluatorStats {
+public:
+	struct Stage {
+		std::uint64_t	calls = 0;
+		std::uint64_t	nanoseconds = 0;		// all calls
+		std::uint64_t	lastNanoseconds = 0;	// the latest call
+		std::uint64_t	allocations = 0;
+		std::uint64_t	lastAllocations = 0;
+		std::uint64_t	exceptions = 0;			// calls that threw
+	};
+
+	Stage			lex, parse, evaluate;
+	std::uint64_t	tokens = 0;					// infix tokens produced by lex
+	std::uint64_t	lastTokens = 0;
+	std::uint64_t	stackHighWater = 0;			// deepest operand stack of any evaluation
+	std::uint64_t	lastStackHighWater = 0;
+
+	static constexpr bool enabled = EE_STATS != 0;
+
+	void reset() { *this = EvaluatorStats{}; }
+
+	/*! Counts one Token allocation on this thread; called by the Token constructor. */
+	static void count_allocation() {
+		if constexpr (enabled)
+			++allocations_s;
+	}
+
+	/*! Times the enclosing block as one call of a stage. */
+	class Timer {
+#if EE_STATS
+		using clock = std::chrono::steady_clock;
+		Stage&				stage_m;
+		clock::time_point	start_m;
+		std::uint64_t		allocations_m;
+		int					exceptions_m;
+	public:
+		explicit Timer(Stage& stage) : stage_m(stage), start_m(clock::now()), allocations_m(allocations_s), exceptions_m(std::uncaught_exceptions()) {}
+		~Timer() {
+			auto const elapsed = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start_m).count());
+			++stage_m.calls;
+			stage_m.nanoseconds += elapsed;
+			stage_m.lastNanoseconds = elapsed;
+			stage_m.lastAllocations = allocations_s - allocations_m;
+			stage_m.allocations += stage_m.lastAllocations;
+			if (std::uncaught_exceptions() > exceptions_m)
+				++stage_m.exceptions;
+		}
+#else
+	public:
+		explicit Timer(Stage&) {}
+#endif
+		Timer(Timer const&) = delete;
+		Timer& operator = (Timer const&) = delete;
+	};
+
+	/*! Records the token count of one lex call. */
+	void record_tokens(std::uint64_t count) {
+		if constexpr (enabled) {
+			tokens += count;
+			lastTokens = count;
+		}
+	}
+
+	/*! Records the operand stack high-water mark of one evaluation. */
+	void record_stack(std::uint64_t depth) {
+		if constexpr (enabled) {
+			lastStackHighWater = depth;
+			if (depth > stackHighWater)
+				stackHighWater = depth;
+		}
+	}
+
+private:
+	static inline thread_local std::uint64_t allocations_s = 0;
+};
+
+/*! Writes a table of the statistics. */
+std::ostream& operator << (std::ostream& os, EvaluatorStats const& stats);
@@ -9,6 +9,14 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Access to the RPN evaluator's fast mode.
+	evaluate() split into compile() and run().
+	evaluate() and compile() take a std::string_view.
+	Added variables().
+	Added evaluate_async().
+	Added stats(): per-stage timing and counters.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -32,16 +40,41 @@ the program(s) have been supplied.
 #include <ee/parser.hpp>
 #include <ee/RPNEvaluator.hpp>
 #include <ee/function.hpp>
+#include <ee/evaluator_stats.hpp>
 
 
 class ExpressionEvaluator {
 public:
-	using expression_type = Token::string_type;
+	using expression_type = Tokenizer::view_type;
 	using result_type = Token::pointer_type;
 private:
 	Tokenizer		tokenizer_m;
 	Parser			parser_m;
 	RPNEvaluator	rpn_m;
+	EvaluatorStats	stats_m;
 public:
-	[[nodiscard]] result_type evaluate(expression_type const& expr);
+	[[nodiscard]] result_type evaluate(expression_type expr);
+
+	/*!	Tokenizes and parses 'expr' into RPN.  Only touches the tokenizer and parser,
+		so it may run on a different thread from run(), one call at a time each. */
+	[[nodiscard]] TokenList compile(expression_type expr);
+
+	/*!	Compiles 'expr' and evaluates it as a coroutine that suspends between slices of
+		work; see RPNEvaluator::evaluate_async(). */
+	[[nodiscard]] EvaluationTask evaluate_async(expression_type expr, AsyncOptions options = {}) { return rpn_m.evaluate_async(compile(expr), options); }
+
+	/*! Evaluates RPN produced by compile(). */
+	[[nodiscard]] result_type run(TokenList const& rpnExpression);
+
+	/*! The variables named by the expressions compiled so far, by name. */
+	[[nodiscard]] Tokenizer::dictionary_type const& variables() const { return tokenizer_m.variables(); }
+
+	/*! The RPN stage, for fast mode settings and counters. */
+	[[nodiscard]] RPNEvaluator& rpn_evaluator() { return rpn_m; }
+	[[nodiscard]] RPNEvaluator const& rpn_evaluator() const { return rpn_m; }
+
+	/*!	Timing and counters of compile() (lex, parse) and run() (evaluate); see
+		evaluator_stats.hpp.  evaluate_async() records only lex and parse. */
+	[[nodiscard]] EvaluatorStats const& stats() const { return stats_m; }
+	void reset_stats() { stats_m.reset(); }
 };
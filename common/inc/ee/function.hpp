@@ -77,7 +77,7 @@ the program(s) have been supplied.
 class Function : public Operation {
 public:
     // Declare the evaluate function to allow derived classes to override it
-    virtual Operand::pointer_type evaluate(std::vector<Operand::pointer_type> const& operands) const {
+    virtual Operand::pointer_type evaluate(std::vector<Operand::pointer_type> const& /*operands*/) const {
         throw std::runtime_error("Evaluate not implemented for this function.");
     }
 };
@@ -12,6 +12,10 @@ Declarations of the Integer class derived from Operand.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	factorial() and power() honour the current EvaluationBudget.
+	Added factorial_terms(), product() and PowerSteps, for evaluations that pause.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -53,6 +57,7 @@ the program(s) have been supplied.
 #pragma once
 #include <ee/operand.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
+#include <cstdint>
 
 /*! Integer token. */
 class Integer : public Operand {
@@ -67,7 +72,23 @@ public:
 	[[nodiscard]] value_type value() const { return value_; }
 	[[nodiscard]] string_type str() const override;
 
-	// Static methods for factorial and power calculations
+	// Static methods for factorial and power calculations.  Both reject results larger than
+	// the current EvaluationBudget allows before starting, and check it as they run.
 	static value_type factorial(value_type n);
 	static value_type power(value_type base, value_type exponent);
+
+	// The pieces of factorial(), for callers that pause between them: the number of terms of
+	// n! (after factorial()'s checks) and the product first * (first + 1) * ... * last.
+	[[nodiscard]] static std::uint64_t factorial_terms(value_type const& n);
+	[[nodiscard]] static value_type product(std::uint64_t first, std::uint64_t last);
+
+	/*! power() one squaring per step(). */
+	class PowerSteps {
+		value_type base_, exponent_, result_ = 1;
+	public:
+		PowerSteps(value_type base, value_type exponent);
+		[[nodiscard]] bool done() const { return exponent_ == 0; }
+		void step();
+		[[nodiscard]] value_type const& result() const { return result_; }
+	};
 };
\ No newline at end of file
@@ -0,0 +1,210 @@
+#pragma once
+/*!	\file	interval.hpp
+	\brief	Interval class declaration and arithmetic.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A closed interval [lo, hi] of doubles that is guaranteed to
+contain the exact result.  Every operation computes its bounds
+in round-to-nearest and then steps each bound one ulp outward
+(two ulps for library transcendentals), so the enclosure holds
+without changing the FPU rounding mode.
+
+Operations whose result cannot be bounded cheaply (domain
+errors, division by an interval containing zero, trigonometric
+functions across an extremum) return an empty optional so the
+caller can fall back to the high precision evaluator.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+
+
+class Interval {
+public:
+	using value_type = double;
+	using optional_type = std::optional<Interval>;
+private:
+	value_type lo_;
+	value_type hi_;
+public:
+	constexpr Interval() : lo_(0), hi_(0) {}
+	constexpr explicit Interval(value_type x) : lo_(x), hi_(x) {}
+	constexpr Interval(value_type lo, value_type hi) : lo_(lo), hi_(hi) {}
+
+	[[nodiscard]] constexpr value_type lo() const { return lo_; }
+	[[nodiscard]] constexpr value_type hi() const { return hi_; }
+	[[nodiscard]] constexpr value_type width() const { return hi_ - lo_; }
+	[[nodiscard]] constexpr value_type mid() const { return lo_ + (hi_ - lo_) / 2; }
+	[[nodiscard]] constexpr bool is_point() const { return lo_ == hi_; }
+	[[nodiscard]] constexpr bool contains(value_type x) const { return lo_ <= x && x <= hi_; }
+	[[nodiscard]] bool is_finite() const { return std::isfinite(lo_) && std::isfinite(hi_); }
+
+	/*! Widen both bounds outward by 'ulps' units in the last place. */
+	[[nodiscard]] Interval widened(unsigned ulps = 1) const {
+		auto lo = lo_, hi = hi_;
+		for (unsigned i = 0; i < ulps; ++i) {
+			lo = std::nextafter(lo, -std::numeric_limits<value_type>::infinity());
+			hi = std::nextafter(hi, std::numeric_limits<value_type>::infinity());
+		}
+		return Interval(lo, hi);
+	}
+
+	/*! Smallest interval holding all of the values. */
+	[[nodiscard]] static Interval hull(value_type a, value_type b, value_type c, value_type d) {
+		return Interval(std::min({ a, b, c, d }), std::max({ a, b, c, d }));
+	}
+};
+
+
+/*! Interval arithmetic. Results are outward rounded. */
+[[nodiscard]] inline Interval operator - (Interval const& a) { return Interval(-a.hi(), -a.lo()); }
+
+[[nodiscard]] inline Interval operator + (Interval const& a, Interval const& b) {
+	return Interval(a.lo() + b.lo(), a.hi() + b.hi()).widened();
+}
+
+[[nodiscard]] inline Interval operator - (Interval const& a, Interval const& b) {
+	return Interval(a.lo() - b.hi(), a.hi() - b.lo()).widened();
+}
+
+[[nodiscard]] inline Interval operator * (Interval const& a, Interval const& b) {
+	return Interval::hull(a.lo() * b.lo(), a.lo() * b.hi(), a.hi() * b.lo(), a.hi() * b.hi()).widened();
+}
+
+/*! Division; empty when the divisor straddles or touches zero. */
+[[nodiscard]] inline Interval::optional_type divide(Interval const& a, Interval const& b) {
+	if (b.contains(0))
+		return std::nullopt;
+	return Interval::hull(a.lo() / b.lo(), a.lo() / b.hi(), a.hi() / b.lo(), a.hi() / b.hi()).widened();
+}
+
+[[nodiscard]] inline Interval abs(Interval const& a) {
+	if (a.lo() >= 0) return a;
+	if (a.hi() <= 0) return -a;
+	return Interval(0, std::max(-a.lo(), a.hi()));
+}
+
+[[nodiscard]] inline Interval max(Interval const& a, Interval const& b) {
+	return Interval(std::max(a.lo(), b.lo()), std::max(a.hi(), b.hi()));
+}
+
+[[nodiscard]] inline Interval min(Interval const& a, Interval const& b) {
+	return Interval(std::min(a.lo(), b.lo()), std::min(a.hi(), b.hi()));
+}
+
+[[nodiscard]] inline Interval ceil(Interval const& a) { return Interval(std::ceil(a.lo()), std::ceil(a.hi())); }
+[[nodiscard]] inline Interval floor(Interval const& a) { return Interval(std::floor(a.lo()), std::floor(a.hi())); }
+
+
+/*! Monotonic library functions. The C library is accurate to within an ulp; two are allowed. */
+[[nodiscard]] inline Interval exp(Interval const& a) {
+	return Interval(std::exp(a.lo()), std::exp(a.hi())).widened(2);
+}
+
+[[nodiscard]] inline Interval::optional_type log(Interval const& a) {
+	if (a.lo() <= 0) return std::nullopt;
+	return Interval(std::log(a.lo()), std::log(a.hi())).widened(2);
+}
+
+[[nodiscard]] inline Interval::optional_type log2(Interval const& a) {
+	if (a.lo() <= 0) return std::nullopt;
+	return Interval(std::log2(a.lo()), std::log2(a.hi())).widened(2);
+}
+
+[[nodiscard]] inline Interval::optional_type log10(Interval const& a) {
+	if (a.lo() <= 0) return std::nullopt;
+	return Interval(std::log10(a.lo()), std::log10(a.hi())).widened(2);
+}
+
+[[nodiscard]] inline Interval::optional_type sqrt(Interval const& a) {
+	if (a.lo() < 0) return std::nullopt;
+	return Interval(std::sqrt(a.lo()), std::sqrt(a.hi())).widened();
+}
+
+[[nodiscard]] inline Interval atan(Interval const& a) {
+	return Interval(std::atan(a.lo()), std::atan(a.hi())).widened(2);
+}
+
+[[nodiscard]] inline Interval::optional_type asin(Interval const& a) {
+	if (a.lo() < -1 || a.hi() > 1) return std::nullopt;
+	return Interval(std::asin(a.lo()), std::asin(a.hi())).widened(2);
+}
+
+[[nodiscard]] inline Interval::optional_type acos(Interval const& a) {
+	if (a.lo() < -1 || a.hi() > 1) return std::nullopt;
+	return Interval(std::acos(a.hi()), std::acos(a.lo())).widened(2);
+}
+
+
+/*! sin, cos and tan are only bounded when the derivative keeps its sign over the
+	interval, i.e. no extremum (or pole) lies inside it.  Since |f''| <= 1 for sin
+	and cos, |f'(mid)| > width guarantees that. */
+[[nodiscard]] inline Interval::optional_type sin(Interval const& a) {
+	if (!(std::abs(std::cos(a.mid())) > a.width() + 1e-12)) return std::nullopt;
+	auto const s0 = std::sin(a.lo()), s1 = std::sin(a.hi());
+	return Interval(std::min(s0, s1), std::max(s0, s1)).widened(2);
+}
+
+[[nodiscard]] inline Interval::optional_type cos(Interval const& a) {
+	if (!(std::abs(std::sin(a.mid())) > a.width() + 1e-12)) return std::nullopt;
+	auto const c0 = std::cos(a.lo()), c1 = std::cos(a.hi());
+	return Interval(std::min(c0, c1), std::max(c0, c1)).widened(2);
+}
+
+[[nodiscard]] inline Interval::optional_type tan(Interval const& a) {
+	if (!(std::abs(std::cos(a.mid())) > a.width() + 1e-12)) return std::nullopt;
+	return Interval(std::tan(a.lo()), std::tan(a.hi())).widened(2);
+}
+
+
+/*! x^y for a strictly positive base.  exp(y ln x) is monotonic in each argument,
+	so the extremes lie on the corners. */
+[[nodiscard]] inline Interval::optional_type pow(Interval const& x, Interval const& y) {
+	if (x.lo() <= 0) return std::nullopt;
+	return Interval::hull(
+		std::pow(x.lo(), y.lo()), std::pow(x.lo(), y.hi()),
+		std::pow(x.hi(), y.lo()), std::pow(x.hi(), y.hi())).widened(2);
+}
+
+/*! x^n for an integer exponent, by repeated squaring. */
+[[nodiscard]] inline Interval::optional_type pow(Interval const& x, long long n) {
+	if (n < 0) {
+		auto p = pow(x, -n);
+		if (!p) return std::nullopt;
+		return divide(Interval(1.0), *p);
+	}
+	Interval result(1.0), base = x;
+	bool evenPower = n % 2 == 0;
+	for (; n > 0; n >>= 1) {
+		if (n & 1) result = result * base;
+		if (n > 1) base = base * base;
+	}
+	// an even power of an interval straddling zero is non-negative
+	if (evenPower && result.lo() < 0)
+		result = Interval(0, result.hi());
+	return result;
+}
@@ -0,0 +1,65 @@
+#pragma once
+/*!	\file	interval_evaluator.hpp
+	\brief	IntervalEvaluator class declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Evaluates an RPN token list with double precision interval
+arithmetic.  Used by RPNEvaluator's fast mode: when the final
+interval is narrow enough for the requested number of digits
+its midpoint is returned, otherwise the expression is evaluated
+again with Real::value_type.
+
+Integer operands are tracked exactly while every intermediate
+stays within 2^53.  Expressions using variables, assignment,
+booleans or results, or that leave the exact integer range, are
+not attempted.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/interval.hpp>
+#include <ee/operand.hpp>
+#include <optional>
+
+
+class IntervalEvaluator {
+public:
+	/*! A stack value: an enclosure, and whether the exact evaluator would hold an Integer. */
+	struct Value {
+		Interval	interval;
+		bool		integer = false;
+	};
+	using result_type = std::optional<Value>;
+
+	/*! Largest magnitude for which every integer is exactly representable as a double. */
+	static constexpr double max_exact_integer = 9007199254740992.0;	// 2^53
+
+	/*! Largest precision a double interval can certify. */
+	static constexpr unsigned max_digits = 15;
+
+	/*! Evaluates 'rpnExpression'; empty when the expression cannot be bounded. */
+	[[nodiscard]] result_type evaluate(TokenList const& rpnExpression) const;
+
+	/*! The operand for 'value' if it is known to 'digits' significant digits, otherwise nullptr. */
+	[[nodiscard]] static Operand::pointer_type certify(Value const& value, unsigned digits);
+};
@@ -0,0 +1,89 @@
+#pragma once
+/*!	\file	jit.hpp
+	\brief	JitFunction class declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Compiles the postfix output of Parser::parse into x86-64
+machine code operating on doubles.
+
+The generated function takes a pointer to an array of doubles,
+one per distinct Variable in the expression (in order of first
+appearance), and returns the value of the expression.  Values
+are kept in stack slots, one per RPN depth, and arithmetic uses
+SSE2 scalar instructions; transcendental functions call the C
+library.
+
+Sub-expressions made only of literals are folded at compile
+time by RPNEvaluator, so Integer semantics (truncating division,
+exact powers) are preserved for them.  compile() returns nullptr
+for anything it cannot translate faithfully: Integer values
+beyond 2^53, Assignment, factorial, Modulus of run-time values,
+booleans and relational operators, result(), and every
+expression on a platform other than x86-64.  The caller then
+evaluates with RPNEvaluator as before.
+
+Run-time arithmetic follows IEEE-754 double semantics, e.g. a
+division by zero yields an infinity rather than an exception.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/token.hpp>
+#include <ee/variable.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+
+class JitFunction {
+	JitFunction(JitFunction const&) = delete;
+	JitFunction& operator = (JitFunction const&) = delete;
+public:
+	using pointer_type = std::unique_ptr<JitFunction>;
+	using signature_type = double (*)(double const* args);
+	using variable_list = std::vector<Variable::pointer_type>;
+
+private:
+	void*			code_m = nullptr;
+	std::size_t		size_m = 0;
+	signature_type	entry_m = nullptr;
+	variable_list	variables_m;
+
+	JitFunction() = default;
+
+public:
+	~JitFunction();
+
+	/*!	Compiles 'rpnExpression'.  Returns nullptr when the expression (or platform)
+		is not supported; evaluate it with RPNEvaluator instead. */
+	[[nodiscard]] static pointer_type compile(TokenList const& rpnExpression);
+
+	/*! Evaluates with 'args[i]' bound to variables()[i]. */
+	[[nodiscard]] double operator () (double const* args = nullptr) const { return entry_m(args); }
+
+	/*! The variables read by the expression, in argument order. */
+	[[nodiscard]] variable_list const& variables() const { return variables_m; }
+
+	/*! Size of the generated machine code in bytes. */
+	[[nodiscard]] std::size_t code_size() const { return size_m; }
+};
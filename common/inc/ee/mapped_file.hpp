@@ -0,0 +1,57 @@
+#pragma once
+/*!	\file	mapped_file.hpp
+	\brief	MappedFile class declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Maps a whole file read-only into memory, so batch input can be
+scanned in place: lines are handed to the tokenizer as views
+into the mapping, with no read() copy into a buffer and no
+per-line string.
+
+Uses mmap() on POSIX systems and CreateFileMapping() on
+Windows.  An empty file maps to an empty view.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+
+class MappedFile {
+	MappedFile(MappedFile const&) = delete;
+	MappedFile& operator = (MappedFile const&) = delete;
+
+	char const*	data_m = nullptr;
+	std::size_t	size_m = 0;
+
+public:
+	/*! Maps 'path'.  Throws std::runtime_error if it cannot be opened or mapped. */
+	explicit MappedFile(std::string const& path);
+	~MappedFile();
+
+	/*! The file contents. */
+	[[nodiscard]] std::string_view contents() const { return { data_m, size_m }; }
+	[[nodiscard]] std::size_t size() const { return size_m; }
+};
@@ -69,14 +69,14 @@ public:
 
 
 /*! Make a new smart-pointer managed Token object with constructor parameter. */
-template <typename T, class... Args> inline Operand::pointer_type [[nodiscard]] make_operand(Args ... params) {
+template <typename T, class... Args> [[nodiscard]] inline Operand::pointer_type make_operand(Args ... params) {
 	return Operand::pointer_type(new T(params...));
 }
 
 
 /*! Gets the value from an operand. */
 template <typename OPERAND_TYPE>
-typename OPERAND_TYPE::value_type [[nodiscard]] value_of(Token::pointer_type const& operand) {
+[[nodiscard]] typename OPERAND_TYPE::value_type value_of(Token::pointer_type const& operand) {
 	assert(is<OPERAND_TYPE>(operand));
 	return dynamic_cast<OPERAND_TYPE*>(operand.get())->value();
 }
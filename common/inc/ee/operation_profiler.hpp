@@ -0,0 +1,128 @@
+#pragma once
+/*!	\file	operation_profiler.hpp
+	\brief	OperationProfiler declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Execution counts and time histograms for the RPN evaluator's
+operations, by operation class (Power, Sin, Factorial...) and by
+the types of its operands (Power(Real, Integer)...):
+
+	OperationProfiler profiler(64);		// time 1 operation in 64
+	evaluator.rpn_evaluator().set_profiler(&profiler);
+	...
+	profiler.report(std::cout);
+
+The profiler samples.  It times one RPN token in 'period' on
+average, at random intervals so that the sample does not lock
+onto the shape of an expression that is evaluated repeatedly, and
+scales the counts and times of the sampled operations by 'period'.
+Between samples it costs one decrement per token, so a period of
+a few dozen can be left on in production; a period of 1 times
+every operation and gives exact counts.
+
+The large Integer factorials and powers that evaluate_async()
+steps through between suspensions are not profiled.
+
+A profiler is not thread safe.  Give each evaluator its own and
+merge() them for the report.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/token.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <typeindex>
+#include <vector>
+
+
+class OperationProfiler {
+public:
+	/*! Histogram bucket i counts the sampled calls that took [2^(i-1), 2^i) ns; bucket 0 those under 1 ns. */
+	static constexpr std::size_t buckets = 40;
+	using histogram_type = std::array<std::uint64_t, buckets>;
+
+	/*! One line of the report.  Counts and times are estimates: the samples scaled by the period. */
+	struct Row {
+		std::string		operation;			// the operation class, e.g. "Power"
+		std::string		operands;			// their types, e.g. "Real, Integer"
+		std::uint64_t	samples = 0;
+		std::uint64_t	calls = 0;
+		std::uint64_t	nanoseconds = 0;
+		double			meanNanoseconds = 0;
+		std::uint64_t	medianNanoseconds = 0;	// upper bound of the bucket
+		std::uint64_t	p99Nanoseconds = 0;		// upper bound of the bucket
+		histogram_type	histogram{};
+	};
+
+	/*! Times one token in 'period' on average; 1 times them all.  Throws std::invalid_argument if 'period' is zero. */
+	explicit OperationProfiler(unsigned period = 1);
+
+	[[nodiscard]] unsigned period() const { return period_m; }
+
+	/*! True when the next token should be timed.  Called by RPNEvaluator for every token. */
+	[[nodiscard]] bool sample() {
+		if (--countdown_m != 0)
+			return false;
+		countdown_m = next_interval();
+		return true;
+	}
+
+	/*! Records one timed operation applied to 'first' and 'second' (nullptr when absent). */
+	void record(Token const& operation, Token const* first, Token const* second, std::chrono::nanoseconds elapsed);
+
+	/*! The operations, by operation and operand types, most expensive first. */
+	[[nodiscard]] std::vector<Row> rows() const;
+
+	/*! The operations by class alone, most expensive first; the operands column is empty. */
+	[[nodiscard]] std::vector<Row> operations() const;
+
+	/*! Writes both tables. */
+	void report(std::ostream& os) const;
+
+	/*! Adds the samples of 'other', which must have the same period. */
+	void merge(OperationProfiler const& other);
+
+	void reset() { entries_m.clear(); }
+
+private:
+	using key_type = std::tuple<std::type_index, std::type_index, std::type_index>;
+	struct Entry {
+		std::uint64_t	samples = 0;
+		std::uint64_t	nanoseconds = 0;
+		histogram_type	histogram{};
+	};
+
+	unsigned					period_m;
+	unsigned					countdown_m;
+	std::uint64_t				random_m = 0x9E3779B97F4A7C15ull;
+	std::map<key_type, Entry>	entries_m;
+
+	[[nodiscard]] unsigned next_interval();
+	[[nodiscard]] Row make_row(std::string operation, std::string operands, Entry const& entry) const;
+};
@@ -110,7 +110,7 @@ public:
 	DEF_POINTER_TYPE(Operator)
 	[[nodiscard]] virtual Precedence precedence() const = 0;
 
-	virtual Operand::pointer_type evaluate(std::vector<Operand::pointer_type> const& operands) const {
+	virtual Operand::pointer_type evaluate(std::vector<Operand::pointer_type> const& /*operands*/) const {
 		throw std::runtime_error("Evaluate not implemented for this Real type.");
 	}
 };
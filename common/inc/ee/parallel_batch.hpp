@@ -0,0 +1,82 @@
+#pragma once
+/*!	\file	parallel_batch.hpp
+	\brief	ParallelBatch class declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Evaluates in-memory batch input (normally a MappedFile) with
+several worker threads.  The input is cut into pieces of about
+1 MiB on line boundaries; each worker takes the next piece,
+evaluates its lines with its own ExpressionEvaluator and keeps
+the output in memory; the calling thread writes the pieces in
+input order.  Workers stay at most a few pieces ahead of the
+writer, so memory use does not grow with the input.
+
+Independent evaluators are only equivalent to one sequential
+evaluator while no line uses a variable.  When a worker meets a
+line that names a variable it stops, the pieces before it are
+written as usual, and the rest of the input, from the start of
+that piece, is evaluated sequentially by a single evaluator.
+No earlier line used a variable, so the output is the same as
+a sequential run.
+
+Output is one line per non-blank input line: the result, or
+'Error: line <n>: <message>'.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+	Added set_limits().
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/evaluation_budget.hpp>
+#include <cstddef>
+#include <cstdio>
+#include <string_view>
+
+
+class ParallelBatch {
+	unsigned	jobs_m;
+	std::size_t	lines_m = 0;
+	std::size_t	failures_m = 0;
+	bool		sequential_m = false;
+	EvaluationBudget::Limits	limits_m;
+
+public:
+	/*! 'jobs' worker threads; 0 uses one per hardware thread. */
+	explicit ParallelBatch(unsigned jobs = 0);
+
+	[[nodiscard]] unsigned jobs() const { return jobs_m; }
+
+	/*! Limits applied to each expression. */
+	void set_limits(EvaluationBudget::Limits const& limits) { limits_m = limits; }
+
+	/*! Evaluates every line of 'text', writing the results to 'output'.  Returns the number of failures. */
+	std::size_t run(std::string_view text, std::FILE* output);
+
+	/*! Expressions evaluated by the last run (blank lines excluded). */
+	[[nodiscard]] std::size_t lines() const { return lines_m; }
+
+	/*! Expressions that failed in the last run, plus one for an output error. */
+	[[nodiscard]] std::size_t failures() const { return failures_m; }
+
+	/*! True if the last run met a variable and finished sequentially. */
+	[[nodiscard]] bool fell_back() const { return sequential_m; }
+};
@@ -0,0 +1,449 @@
+#pragma once
+/*!	\file	real_kernels.hpp
+	\brief	High-precision exp, ln and atan kernels.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Dedicated kernels for the transcendental functions used by the
+Real functions Exp, Ln, Lb, Log, Arctan and Arctan2.
+
+	real_kernels::exp()
+	real_kernels::log()
+	real_kernels::log2()
+	real_kernels::log10()
+	real_kernels::atan()
+	real_kernels::atan2()
+
+exp() and atan() sum their series by binary splitting over exact
+integers, using the bit-burst decomposition of the argument so that
+every sub-series has a short rational argument.  log() uses the
+arithmetic-geometric mean.  All kernels work in a fixed-point
+(cpp_int) or extended precision representation carrying guard bits
+and round once into the caller's type.
+
+The kernels are templates over any cpp_dec_float based number so
+they can be exercised at different precisions.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+	Long loops call EvaluationBudget::checkpoint().
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/evaluation_budget.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+
+
+namespace real_kernels {
+
+	namespace detail {
+
+		using integer_type = boost::multiprecision::cpp_int;
+
+		/*! Extended precision type used for intermediate results. */
+		template <typename T> struct extended;
+
+		template <unsigned Digits10, typename ExponentType, typename Allocator, boost::multiprecision::expression_template_option ET>
+		struct extended<boost::multiprecision::number<boost::multiprecision::cpp_dec_float<Digits10, ExponentType, Allocator>, ET>> {
+			static constexpr unsigned guard_digits = 20;
+			using type = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<Digits10 + guard_digits, ExponentType, Allocator>, ET>;
+		};
+
+		template <typename T> using extended_t = typename extended<T>::type;
+
+
+		/*! Number of fixed-point fraction bits used for a type: its precision plus 64 guard bits. */
+		template <typename T>
+		[[nodiscard]] inline unsigned working_bits() {
+			return static_cast<unsigned>(std::ceil(std::numeric_limits<T>::digits10 * 3.3219280948873623)) + 64;
+		}
+
+
+		/*! 2^e in T, cached per thread (ldexp on a decimal type is expensive). */
+		template <typename T>
+		[[nodiscard]] T const& pow2(int e) {
+			thread_local std::map<int, T> cache;
+			auto iter = cache.find(e);
+			if (iter == cache.end())
+				iter = cache.emplace(e, boost::multiprecision::ldexp(T(1), e)).first;
+			return iter->second;
+		}
+
+
+		/*!	Truncates x * 2^bits to an integer.
+			Goes through the decimal digit string: boost's generic float to cpp_int
+			conversion is quadratic and dominates the kernels otherwise.
+		*/
+		template <typename T>
+		[[nodiscard]] inline integer_type to_fixed(T const& x, unsigned bits) {
+			std::string digits = T(boost::multiprecision::trunc(x * pow2<T>(static_cast<int>(bits)))).str(0, std::ios_base::fixed);
+			auto point = digits.find('.');
+			if (point != std::string::npos)
+				digits.erase(point);
+			return integer_type(digits);
+		}
+
+
+		/*! Converts a fixed-point integer with 'bits' fraction bits to T. */
+		template <typename T>
+		[[nodiscard]] inline T from_fixed(integer_type const& f, unsigned bits) {
+			return T(f.str()) * pow2<T>(-static_cast<int>(bits));
+		}
+
+
+		/*! Result of a binary splitting step: sum = T/Q, running product = P/Q. */
+		struct split_type {
+			integer_type P, Q, T;
+		};
+
+
+		/*!	Binary splitting of sum_{n=a}^{b-1} prod_{k=a}^{n} p(k)/q(k).
+			\return {P, Q, T} with the partial sum equal to T/Q.
+		*/
+		template <typename PF, typename QF>
+		[[nodiscard]] split_type binary_split(std::uint64_t a, std::uint64_t b, PF const& p, QF const& q) {
+			if (b - a == 1) {
+				integer_type pa = p(a);
+				return { pa, q(a), pa };
+			}
+			auto m = a + (b - a) / 2;
+			split_type l = binary_split(a, m, p, q);
+			split_type r = binary_split(m, b, p, q);
+			EvaluationBudget::checkpoint();
+			return { l.P * r.P, l.Q * r.Q, l.T * r.Q + l.P * r.T };
+		}
+
+
+		/*! Index of the most significant bit of a non-zero magnitude. */
+		[[nodiscard]] inline long msb(integer_type const& n) {
+			return static_cast<long>(boost::multiprecision::msb(boost::multiprecision::abs(n)));
+		}
+
+
+		/*!	exp(n / 2^m) as a fixed-point number with 'bits' fraction bits, |n / 2^m| < 1. */
+		[[nodiscard]] inline integer_type exp_rational(integer_type const& n, unsigned m, unsigned bits) {
+			if (n == 0)
+				return integer_type(1) << bits;
+
+			// smallest N with |n/2^m|^N / N! < 2^-(bits+2)
+			double log2x = double(msb(n) + 1) - double(m);
+			std::uint64_t N = 1;
+			double log2term = log2x;
+			while (log2term > -double(bits) - 2.0) {
+				++N;
+				log2term += log2x - std::log2(double(N));
+			}
+
+			auto s = binary_split(1, N + 1,
+				[&](std::uint64_t) { return n; },
+				[&](std::uint64_t k) { return integer_type(k) << m; });
+			return ((s.Q + s.T) << bits) / s.Q;
+		}
+
+
+		/*!	atan(n / 2^m) as a fixed-point number with 'bits' fraction bits, 0 < n / 2^m < 1/2, m <= bits. */
+		[[nodiscard]] inline integer_type atan_rational(integer_type const& n, unsigned m, unsigned bits) {
+			if (n == 0)
+				return 0;
+
+			// smallest N with x^(2N+1) / (2N+1) < 2^-(bits+2)
+			double log2x = double(msb(n) + 1) - double(m);
+			std::uint64_t N = 1;
+			while ((2.0 * N + 1.0) * log2x - std::log2(2.0 * N + 1.0) > -double(bits) - 2.0)
+				++N;
+
+			integer_type n2 = n * n;
+			auto s = binary_split(1, N + 1,
+				[&](std::uint64_t k) { return -integer_type(2 * k - 1) * n2; },
+				[&](std::uint64_t k) { return integer_type(2 * k + 1) << (2 * m); });
+			return ((n * (s.Q + s.T)) << (bits - m)) / s.Q;
+		}
+
+
+		/*!	atanh(1/q) as a fixed-point number with 'bits' fraction bits. */
+		[[nodiscard]] inline integer_type atanh_inverse(unsigned q, unsigned bits) {
+			double log2x = -std::log2(double(q));
+			std::uint64_t N = 1;
+			while ((2.0 * N + 1.0) * log2x > -double(bits) - 2.0)
+				++N;
+
+			integer_type q2 = integer_type(q) * q;
+			auto s = binary_split(1, N + 1,
+				[&](std::uint64_t k) { return integer_type(2 * k - 1); },
+				[&](std::uint64_t k) { return integer_type(2 * k + 1) * q2; });
+			return ((s.Q + s.T) << bits) / (s.Q * q);
+		}
+
+
+		/*!	ln(2) as a fixed-point number with 'bits' fraction bits.
+			ln 2 = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749)
+		*/
+		[[nodiscard]] inline integer_type ln2_fixed(unsigned bits) {
+			unsigned const g = bits + 8;
+			integer_type r = 18 * atanh_inverse(26, g) - 2 * atanh_inverse(4801, g) + 8 * atanh_inverse(8749, g);
+			return r >> 8;
+		}
+
+
+		/*! Fixed-point precision of the cached ln(2) for T: enough for every kernel on T. */
+		template <typename T>
+		[[nodiscard]] inline unsigned ln2_bits() {
+			return working_bits<extended_t<T>>() + 64;
+		}
+
+
+		/*! ln(2) with ln2_bits<T>() fraction bits, computed once per type. */
+		template <typename T>
+		[[nodiscard]] integer_type const& ln2_cached() {
+			static integer_type const ln2 = ln2_fixed(ln2_bits<T>());
+			return ln2;
+		}
+
+
+		/*! ln(2) as a fixed-point number with 'bits' fraction bits, bits <= ln2_bits<T>(). */
+		template <typename T>
+		[[nodiscard]] integer_type ln2_at(unsigned bits) {
+			return ln2_cached<T>() >> (ln2_bits<T>() - bits);
+		}
+
+
+		/*!	Bit-burst exp of a fixed-point argument |R / 2^bits| < 1.
+			The argument is split into chunks r_j = n_j / 2^(2^(j+1)) whose numerators
+			have about 2^j bits, exp(r) = prod exp(r_j).
+		*/
+		[[nodiscard]] inline integer_type exp_fixed(integer_type const& R, unsigned bits) {
+			bool negative = R < 0;
+			integer_type rest = boost::multiprecision::abs(R);
+			integer_type result = integer_type(1) << bits;
+
+			unsigned lo = 0;
+			for (unsigned hi = 2; lo < bits && rest != 0; lo = hi, hi *= 2) {
+				if (hi > bits) hi = bits;
+
+				integer_type chunk = rest >> (bits - hi);	// fraction bits 1..hi
+				rest -= chunk << (bits - hi);
+				if (chunk == 0) continue;
+
+				result = (result * exp_rational(negative ? integer_type(-chunk) : chunk, hi, bits)) >> bits;
+			}
+			return result;
+		}
+
+
+		/*!	Bit-burst atan of a fixed-point argument 0 <= Y / 2^bits <= 1/4.
+			The leading chunk a of y is removed with atan(y) = atan(a) + atan((y-a)/(1+a*y)),
+			leaving a remainder with twice as many leading zero bits.
+		*/
+		[[nodiscard]] inline integer_type atan_fixed(integer_type Y, unsigned bits) {
+			integer_type const one = integer_type(1) << bits;
+			integer_type result = 0;
+
+			for (unsigned m = 8; Y != 0; m *= 2) {
+				if (m > bits) m = bits;
+
+				integer_type a = Y >> (bits - m);
+				if (a != 0) {
+					result += atan_rational(a, m, bits);
+					integer_type A = a << (bits - m);
+					Y = ((Y - A) << bits) / (one + ((A * Y) >> bits));
+				}
+				if (m == bits) break;
+			}
+			return result;
+		}
+
+		/*!	Natural logarithm of x > 0 at the precision of W, where W is the extended type of T.
+			ln x = pi / (2 AGM(1, 4/s)) - m ln 2, with s = x 2^m > 2^(p/2).
+		*/
+		template <typename T, typename W>
+		[[nodiscard]] W log_work(W const& x) {
+			unsigned const bits = working_bits<W>();
+
+			// Close to 1 the AGM cancels; use ln x = 2 atanh(z), z = (x-1)/(x+1).
+			W const z = (x - 1) / (x + 1);
+			if (boost::multiprecision::abs(z) < boost::multiprecision::ldexp(W(1), -64)) {
+				W const z2 = z * z;
+				W const eps = boost::multiprecision::ldexp(W(1), -static_cast<int>(bits));
+				W term = z, sum = z;
+				for (unsigned k = 3; boost::multiprecision::abs(term) > eps * boost::multiprecision::abs(sum); k += 2) {
+					EvaluationBudget::checkpoint();
+					term *= z2;
+					sum += term / k;
+				}
+				return 2 * sum;
+			}
+
+			int e;
+			boost::multiprecision::frexp(x, &e);
+			int const m = static_cast<int>(bits / 2) + 2 - e;
+			W const s = boost::multiprecision::ldexp(x, m);
+
+			W a = 1, b = 4 / s;
+			W const eps = boost::multiprecision::ldexp(W(1), -static_cast<int>(bits / 2));
+			while (boost::multiprecision::abs(a - b) > eps * a) {
+				EvaluationBudget::checkpoint();
+				W const t = (a + b) / 2;
+				b = boost::multiprecision::sqrt(a * b);
+				a = t;
+			}
+			a = (a + b) / 2;
+
+			return boost::math::constants::pi<W>() / (2 * a) - m * from_fixed<W>(ln2_at<T>(bits), bits);
+		}
+
+
+		/*!	Arc tangent of y > 0 at the precision of W. */
+		template <typename W>
+		[[nodiscard]] W atan_work(W y) {
+			unsigned const bits = working_bits<W>();
+
+			// reduce to 0 < y <= 1, atan(y) = pi/2 - atan(1/y) for y > 1
+			bool const inverted = y > 1;
+			if (inverted) y = 1 / y;
+
+			// two argument halvings, atan(y) = 2 atan(y / (1 + sqrt(1 + y^2))), give y <= tan(pi/16)
+			for (int i = 0; i < 2; ++i)
+				y = y / (1 + boost::multiprecision::sqrt(1 + y * y));
+
+			W result = 4 * from_fixed<W>(atan_fixed(to_fixed(y, bits), bits), bits);
+			if (inverted) result = boost::math::constants::pi<W>() / 2 - result;
+			return result;
+		}
+
+	} // end-of-namespace detail
+
+
+
+	/*!	Exponential function, e^x. */
+	template <typename T>
+	[[nodiscard]] T exp(T const& x) {
+		using namespace detail;
+
+		// Outside this range the result is not representable; keep the library semantics.
+		// Below ~200 digits the library's own series is faster than the split.
+		if (std::numeric_limits<T>::digits10 < 200
+			|| !(boost::multiprecision::isfinite)(x) || boost::multiprecision::abs(x) > T(1'000'000'000))
+			return boost::multiprecision::exp(x);
+		if (x == 0)
+			return T(1);
+
+		unsigned const bits = working_bits<T>();
+		unsigned const g = 40;	// covers the magnitude of k
+		integer_type const ln2 = ln2_at<T>(bits + g);
+
+		// x = k ln2 + r, |r| <= ln2/2
+		integer_type X = to_fixed(x, bits + g);
+		integer_type const half = ln2 >> 1;
+		integer_type k = (X < 0 ? integer_type(X - half) : integer_type(X + half)) / ln2;
+		integer_type R = (X - k * ln2) >> g;
+
+		T result = from_fixed<T>(exp_fixed(R, bits), bits);
+		return boost::multiprecision::ldexp(result, k.template convert_to<int>());
+	}
+
+
+
+	/*!	Natural logarithm. */
+	template <typename T>
+	[[nodiscard]] T log(T const& x) {
+		using W = detail::extended_t<T>;
+
+		if (!(boost::multiprecision::isfinite)(x) || x <= 0)
+			return boost::multiprecision::log(x);
+		if (x == 1)
+			return T(0);
+
+		return T(detail::log_work<T>(W(x)));
+	}
+
+
+
+	/*!	Base-2 logarithm. Exact for powers of two. */
+	template <typename T>
+	[[nodiscard]] T log2(T const& x) {
+		using namespace detail;
+		using W = extended_t<T>;
+
+		if (!(boost::multiprecision::isfinite)(x) || x <= 0)
+			return boost::multiprecision::log2(x);
+
+		int e;
+		if (boost::multiprecision::frexp(x, &e) == T(0.5))
+			return T(e - 1);
+
+		unsigned const bits = working_bits<W>();
+		return T(log_work<T>(W(x)) / from_fixed<W>(ln2_at<T>(bits), bits));
+	}
+
+
+
+	/*!	Base-10 logarithm. Exact for powers of ten. */
+	template <typename T>
+	[[nodiscard]] T log10(T const& x) {
+		using W = detail::extended_t<T>;
+
+		if (!(boost::multiprecision::isfinite)(x) || x <= 0)
+			return boost::multiprecision::log10(x);
+
+		double const approx = std::round(std::log10(x.template convert_to<double>()));
+		if (std::isfinite(approx) && std::abs(approx) < 1.0e6 && x == boost::multiprecision::pow(T(10), static_cast<int>(approx)))
+			return T(static_cast<int>(approx));
+
+		static W const ln10 = detail::log_work<T>(W(10));
+		return T(detail::log_work<T>(W(x)) / ln10);
+	}
+
+
+
+	/*!	Arc tangent. */
+	template <typename T>
+	[[nodiscard]] T atan(T const& x) {
+		using W = detail::extended_t<T>;
+
+		if (!(boost::multiprecision::isfinite)(x) || x == 0)
+			return boost::multiprecision::atan(x);
+
+		W const r = detail::atan_work(W(boost::multiprecision::abs(x)));
+		return T(x < 0 ? W(-r) : r);
+	}
+
+
+
+	/*!	Two argument arc tangent, atan(y/x) placed in the quadrant of (x, y). */
+	template <typename T>
+	[[nodiscard]] T atan2(T const& y, T const& x) {
+		using W = detail::extended_t<T>;
+
+		if (!(boost::multiprecision::isfinite)(x) || !(boost::multiprecision::isfinite)(y) || x == 0 || y == 0)
+			return boost::multiprecision::atan2(y, x);
+
+		W const a = detail::atan_work(W(boost::multiprecision::abs(y)) / W(boost::multiprecision::abs(x)));
+		W const r = x > 0 ? a : boost::math::constants::pi<W>() - a;
+		return T(y < 0 ? W(-r) : r);
+	}
+
+} // end-of-namespace real_kernels
@@ -0,0 +1,108 @@
+#pragma once
+/*!	\file	slow_log.hpp
+	\brief	SlowLog declaration.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A slow-expression log: every expression whose evaluation takes
+at least a threshold is appended to a file, one JSON object per
+line.
+
+	SlowLog log("slow.jsonl", std::chrono::milliseconds(100));
+	auto result = log.evaluate(evaluator, "100000!");
+
+An entry holds the expression, the elapsed time and its lex,
+parse and evaluate parts, the type and size of the result
+(its decimal digits, estimated from the bit length for
+an Integer, and an Integer's limbs), the operation that
+took the most time, and the error message if the evaluation
+threw.  Expressions that throw are logged like the rest, so a
+budget overrun that takes longer than the threshold is caught.
+
+The phase times come from EvaluatorStats; with EE_STATS defined
+as 0 they are zero, but the elapsed time is still measured.  To
+find the hottest operation, SlowLog::evaluate() times every
+operation with an OperationProfiler, which costs two clock reads
+per RPN token.
+
+A background thread writes the entries, so evaluate() never waits
+for the file.  An entry that finds the queue full is dropped and
+counted.  Only one thread may call evaluate().
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <ee/expression_evaluator.hpp>
+#include <ee/operation_profiler.hpp>
+#include <ee/spsc_queue.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+
+class SlowLog {
+public:
+	static constexpr std::size_t default_queue_entries = 1024;
+
+	/*!	Appends entries to 'path' for the expressions that take at least 'threshold'.
+		Throws std::runtime_error if the file cannot be opened. */
+	SlowLog(std::string const& path, std::chrono::nanoseconds threshold, std::size_t queueEntries = default_queue_entries);
+
+	/*! Writes the queued entries and closes the file. */
+	~SlowLog();
+
+	SlowLog(SlowLog const&) = delete;
+	SlowLog& operator = (SlowLog const&) = delete;
+
+	/*!	Evaluates 'expr' with 'evaluator', logging it if it is slow.  Rethrows the
+		evaluator's exceptions. */
+	ExpressionEvaluator::result_type evaluate(ExpressionEvaluator& evaluator, std::string_view expr);
+
+	[[nodiscard]] std::chrono::nanoseconds threshold() const { return threshold_m; }
+
+	/*! Expressions logged (queued for writing) so far. */
+	[[nodiscard]] std::uint64_t logged() const { return logged_m; }
+
+	/*! Entries dropped because the queue was full. */
+	[[nodiscard]] std::uint64_t dropped() const { return dropped_m; }
+
+private:
+	std::chrono::nanoseconds	threshold_m;
+	OperationProfiler			profiler_m;
+	SpscQueue<std::string>		queue_m;		// JSON lines
+	std::ofstream				file_m;
+	std::mutex					mutex_m;
+	std::condition_variable		wake_m;
+	bool						stopping_m = false;
+	std::uint64_t				logged_m = 0;
+	std::uint64_t				dropped_m = 0;
+	std::thread					writer_m;
+
+	void write_entries();
+	void push(std::string line);
+};
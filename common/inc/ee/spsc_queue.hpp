@@ -0,0 +1,104 @@
+#pragma once
+/*!	\file	spsc_queue.hpp
+	\brief	SpscQueue class template.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A bounded, lock-free queue between exactly one producer thread
+and one consumer thread.  The ring buffer holds a power of two
+slots; the head (consumer) and tail (producer) counters live on
+separate cache lines and are the only shared state.
+
+push() and pop() spin, yielding the processor, while the queue
+is full or empty.  A full queue therefore stalls the producer,
+which is the back-pressure that bounds memory use in a
+pipeline of stages.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+template <typename T>
+class SpscQueue {
+	SpscQueue(SpscQueue const&) = delete;
+	SpscQueue& operator = (SpscQueue const&) = delete;
+
+	static constexpr std::size_t cache_line = 64;
+
+	std::vector<T>		slots_m;
+	std::size_t			mask_m;
+	alignas(cache_line) std::atomic<std::size_t> head_m{ 0 };	// next slot to pop; written by the consumer
+	alignas(cache_line) std::atomic<std::size_t> tail_m{ 0 };	// next slot to push; written by the producer
+
+	[[nodiscard]] static std::size_t round_up(std::size_t n) {
+		std::size_t p = 1;
+		while (p < n)
+			p <<= 1;
+		return p;
+	}
+
+public:
+	/*! A queue holding at least 'capacity' items. */
+	explicit SpscQueue(std::size_t capacity) : slots_m(round_up(capacity == 0 ? 1 : capacity)), mask_m(slots_m.size() - 1) { }
+
+	[[nodiscard]] std::size_t capacity() const { return slots_m.size(); }
+
+	/*! Producer: appends 'value' unless the queue is full.  'value' is only moved from on success. */
+	[[nodiscard]] bool try_push(T& value) {
+		auto const tail = tail_m.load(std::memory_order_relaxed);
+		if (tail - head_m.load(std::memory_order_acquire) == slots_m.size())
+			return false;
+		slots_m[tail & mask_m] = std::move(value);
+		tail_m.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/*! Consumer: removes the oldest item into 'value' unless the queue is empty. */
+	[[nodiscard]] bool try_pop(T& value) {
+		auto const head = head_m.load(std::memory_order_relaxed);
+		if (head == tail_m.load(std::memory_order_acquire))
+			return false;
+		value = std::move(slots_m[head & mask_m]);
+		head_m.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/*! Producer: appends 'value', waiting while the queue is full. */
+	void push(T value) {
+		while (!try_push(value))
+			std::this_thread::yield();
+	}
+
+	/*! Consumer: removes the oldest item, waiting while the queue is empty. */
+	[[nodiscard]] T pop() {
+		T value;
+		while (!try_pop(value))
+			std::this_thread::yield();
+		return value;
+	}
+};
@@ -12,6 +12,9 @@ Declarations of the Token class.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	The constructor counts allocations for EvaluatorStats (defaulted when EE_STATS is 0).
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -44,6 +47,7 @@ stipulated in the agreement/contract under which
 the program(s) have been supplied.
 =============================================================*/
 
+#include <ee/evaluator_stats.hpp>
 #include <memory>
 #include <utility>
 #include <string>
@@ -69,7 +73,11 @@ public:
 	Token(Token const&) = delete;
 	Token& operator = (Token const&) = delete;
 
-	constexpr Token() = default;
+#if EE_STATS
+	Token() { EvaluatorStats::count_allocation(); }
+#else
+	Token() = default;
+#endif
 	virtual ~Token() = default;
 	[[nodiscard]] virtual string_type str() const;
 };
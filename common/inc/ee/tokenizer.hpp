@@ -9,6 +9,11 @@
 Revision History
 ------------------------------------------------------------ -
 
+Version 2026.10.18
+	Added variables() accessor.
+	tokenize() takes a std::string_view, so callers need not build a string per line.
+	XTokenizer derives from std::runtime_error; std::exception(char const*) is MSVC only.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -57,7 +62,9 @@ the program(s) have been supplied.
 
 #include <ee/token.hpp>
 #include <map>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 
 /*! Tokenizer class is used to create lists of tokens from expression strings.
@@ -71,13 +78,14 @@ class Tokenizer {
 // TYPES
 public:
 	using string_type = Token::string_type;
+	using view_type = std::string_view;
 
-	class XTokenizer : public std::exception {
+	class XTokenizer : public std::runtime_error {
 		string_type	expression_m;
 		std::size_t	location_m;
 	public:
 		XTokenizer(string_type const& expression, std::size_t location, char const* msg)
-			: std::exception(msg)
+			: std::runtime_error(msg)
 			, expression_m(expression)
 			, location_m(location)
 		{ }
@@ -101,7 +109,6 @@ public:
 			: XTokenizer( expression, location, "Tokenizer::Too many digits in number." ) { }
 	};
 
-private:
 	using dictionary_type = std::map<string_type, Token::pointer_type>;
 
 // ATTRIBUTES
@@ -112,10 +119,13 @@ private:
 // OPERATIONS
 public:
 	Tokenizer();
-	TokenList tokenize(string_type const& expression);
+	TokenList tokenize(view_type expression);
+
+	/*! The variables introduced by the expressions tokenized so far, by name. */
+	[[nodiscard]] dictionary_type const& variables() const { return variables_m; }
 
 private:
-	[[nodiscard]] Token::pointer_type _get_identifier(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression);
-	[[nodiscard]] Token::pointer_type _get_number(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression);
+	[[nodiscard]] Token::pointer_type _get_identifier(view_type::const_iterator& currentChar, view_type expression);
+	[[nodiscard]] Token::pointer_type _get_number(view_type::const_iterator& currentChar, view_type expression);
 };
 
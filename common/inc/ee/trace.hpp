@@ -0,0 +1,107 @@
+#pragma once
+/*!	\file	trace.hpp
+	\brief	Tracer and TraceSpan declarations.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+A timeline of evaluation phases across threads, written in the
+Chrome trace-event JSON format, which chrome://tracing and
+ui.perfetto.dev load offline:
+
+	Tracer::start("ee.trace.json");
+	...evaluate...
+	Tracer::stop();
+
+A TraceSpan records the time from its construction to its
+destruction as one complete ("X") event.  The library records
+spans for tokenize, parse, fast mode (the interval pre-pass that
+stands in for an optimizer), evaluate, and the expensive kernels:
+the transcendental and root functions, Integer factorial and
+power, and the conversion of numbers to strings.
+
+Each thread records into its own ring buffer, so recording takes
+no lock.  A background thread drains the buffers to the file
+every few milliseconds and when the tracer stops.  A span that
+finds its thread's buffer full is dropped and counted; dropped()
+reports the total.
+
+While no trace is running, a TraceSpan costs one atomic load.
+Span names and categories must be string literals (or otherwise
+outlive the trace): only the pointers are recorded.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+class Tracer {
+public:
+	using clock = std::chrono::steady_clock;
+
+	static constexpr std::size_t default_buffer_events = 1 << 14;
+
+	/*!	Starts writing a trace to 'path'.  A thread's ring buffer holds 'bufferEvents'
+		spans, as set when the thread first records one.  Throws std::runtime_error
+		if a trace is running or the file cannot be created. */
+	static void start(std::string const& path, std::size_t bufferEvents = default_buffer_events);
+
+	/*! Writes the remaining spans and closes the file.  Does nothing if no trace is running. */
+	static void stop();
+
+	[[nodiscard]] static bool enabled() { return enabled_s.load(std::memory_order_relaxed); }
+
+	/*! Spans dropped by full buffers since start(). */
+	[[nodiscard]] static std::uint64_t dropped();
+
+	/*! Records a span on the calling thread. */
+	static void record(char const* name, char const* category, clock::time_point begin, clock::time_point end);
+
+private:
+	static inline std::atomic<bool> enabled_s{ false };
+};
+
+
+
+/*! Records the lifetime of a scope as a span, while a trace is running. */
+class TraceSpan {
+	char const*			name_m;
+	char const*			category_m;
+	Tracer::clock::time_point	begin_m;
+	bool				active_m;
+
+public:
+	explicit TraceSpan(char const* name, char const* category = "ee") : name_m(name), category_m(category), active_m(Tracer::enabled()) {
+		if (active_m)
+			begin_m = Tracer::clock::now();
+	}
+	~TraceSpan() {
+		if (active_m)
+			Tracer::record(name_m, category_m, begin_m, Tracer::clock::now());
+	}
+	TraceSpan(TraceSpan const&) = delete;
+	TraceSpan& operator = (TraceSpan const&) = delete;
+};
@@ -8,6 +8,18 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+    exp, ln, lb, log, arctan and arctan2 use the binary-splitting/AGM kernels.
+    Added the missing log branch.
+    Fast mode tries the IntervalEvaluator first.
+    Variables are replaced by their values before every operation except assignment.
+    Evaluations run under budget(); oversized Integer products, powers and factorials are rejected up front.
+    Integer powers check the exponent instead of truncating it to unsigned; pow() with a negative one gives a Real.
+    The loop body is apply(); evaluate_async() runs it as a coroutine, in slices.
+    evaluate() records the operand stack high-water mark for EvaluatorStats.
+    Operations are sampled into the OperationProfiler, if one is set.
+    Fast mode and the transcendental and root functions record trace spans.
+
 Version 2021.11.01
     C++ 20 validated
     Changed to GATS_TEST
@@ -28,7 +40,15 @@ Version 2009.12.10
 #include <ee/operator.hpp>
 #include <ee/function.hpp>
 #include <ee/variable.hpp>
+#include <ee/real_kernels.hpp>
+#include <ee/interval_evaluator.hpp>
+#include <ee/operation_profiler.hpp>
+#include <ee/trace.hpp>
 #include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <optional>
 #include <stack>
 #include <stdexcept>
 #include <vector>
@@ -54,525 +74,794 @@ inline typename T::value_type pop_operand_from_stack(std::stack<Operand::pointer
     return operand->value();
 }
 
+// Replaces any Variables among the top 'count' operands with their values
+inline void dereference_variables(std::stack<Operand::pointer_type>& operandStack, unsigned count) {
+    if (operandStack.size() < count) {
+        throw std::runtime_error("Error: insufficient operands");
+    }
+    std::vector<Operand::pointer_type> operands;
+    for (unsigned i = 0; i < count; ++i) {
+        operands.push_back(operandStack.top());
+        operandStack.pop();
+    }
+    for (auto it = operands.rbegin(); it != operands.rend(); ++it) {
+        if (auto variable = std::dynamic_pointer_cast<Variable>(*it)) {
+            if (!variable->value()) {
+                throw std::runtime_error("Error: variable not initialized");
+            }
+            operandStack.push(variable->value());
+        }
+        else {
+            operandStack.push(*it);
+        }
+    }
+}
+
+
+// An Integer power with more result bits than this is computed a squaring at a time by evaluate_async().
+constexpr double large_power_bits = 1 << 16;
+
+
+// Integer ** Integer: an Integer, or a Real for a negative exponent.  Exponents beyond an unsigned
+// are only meaningful for the bases 0, 1 and -1, whose powers depend on the exponent's parity.
+inline Operand::pointer_type integer_power(Integer::value_type const& base, Integer::value_type const& exponent) {
+    Integer::value_type magnitude = boost::multiprecision::abs(exponent);
+    if (magnitude > std::numeric_limits<unsigned>::max()) {
+        if (boost::multiprecision::abs(base) > 1) {
+            EvaluationBudget::check_current_bits(static_cast<double>(boost::multiprecision::msb(boost::multiprecision::abs(base))) * magnitude.convert_to<double>() + 1);
+            throw std::runtime_error("Error: exponent too large");
+        }
+        magnitude = magnitude % 2 == 0 ? 2 : 1;
+    }
+    if (exponent < 0) {
+        return std::make_shared<Real>(Real::value_type(1.0) / boost::multiprecision::pow(static_cast<Real::value_type>(base), magnitude.convert_to<unsigned>()));
+    }
+    return std::make_shared<Integer>(Integer::power(base, magnitude));
+}
+
 
 [[nodiscard]] Operand::pointer_type RPNEvaluator::evaluate(TokenList const& rpnExpression) {
     if (rpnExpression.empty()) {
         throw std::runtime_error("Error: insufficient operands");
     }
 
-    std::stack<Operand::pointer_type> operandStack;
+    if (running_m) {
+        throw std::runtime_error("Error: an asynchronous evaluation is in progress");
+    }
+    budget_m.start();
+    EvaluationBudget::Scope budgetScope(budget_m);
+    stackHighWater_m = 0;
+
+    if (auto result = fast_result(rpnExpression)) {
+        return result;
+    }
 
+    operand_stack operandStack;
     for (auto const& token : rpnExpression) {
-        if (is<Operand>(token)) {
-            operandStack.push(convert<Operand>(token));
-        }
-        else if (is<Operator>(token)) {
-            if (is<Identity>(token)) {
-                auto value = operandStack.top(); operandStack.pop();
-                if (auto intValue = std::dynamic_pointer_cast<Integer>(value)) {
-                    operandStack.push(std::make_shared<Integer>(intValue->value()));
-                }
-                else if (auto realValue = std::dynamic_pointer_cast<Real>(value)) {
-                    operandStack.push(std::make_shared<Real>(realValue->value()));
-                }
-                else {
-                    throw std::runtime_error("Invalid operand type for identity");
-                }
-            }
-            else if (is<Negation>(token)) {
-                auto operand = operandStack.top();
-                operandStack.pop();
+        if (profiler_m && profiler_m->sample())
+            profiled_apply(token, operandStack);
+        else
+            apply(token, operandStack);
+        if constexpr (EvaluatorStats::enabled) {
+            if (operandStack.size() > stackHighWater_m)
+                stackHighWater_m = operandStack.size();
+        }
+    }
 
-                if (auto var = std::dynamic_pointer_cast<Variable>(operand)) {
-                    if (!var->value()) {  // Check if the variable has been assigned a value
-                        throw std::runtime_error("Error: variable not initialized");
-                    }
-                }
+    if (operandStack.size() != 1) {
+        throw std::runtime_error("Error: too many operands");
+    }
 
-                // Proceed with negation if operand is an Integer or Real
-                if (auto intValue = std::dynamic_pointer_cast<Integer>(operand)) {
-                    operandStack.push(std::make_shared<Integer>(-intValue->value()));
-                }
-                else if (auto realValue = std::dynamic_pointer_cast<Real>(operand)) {
-                    operandStack.push(std::make_shared<Real>(-realValue->value()));
-                }
-                else {
-                    throw std::runtime_error("Invalid operand type for negation");
-                }
-            }
-            else if (is<Assignment>(token)) {
-                auto valueOperand = operandStack.top(); operandStack.pop();
-                auto variableOperand = operandStack.top(); operandStack.pop();
+    return operandStack.top();
+}
 
-                auto variable = std::dynamic_pointer_cast<Variable>(variableOperand);
-                if (!variable) {
-                    throw std::runtime_error("Error: assignment to a non-variable.");
-                }
 
-                // Ensure the value is properly assigned based on operand type
-                if (auto boolValue = std::dynamic_pointer_cast<Boolean>(valueOperand)) {
-                    variable->set(std::make_shared<Boolean>(boolValue->value()));
-                }
-                else if (auto intValue = std::dynamic_pointer_cast<Integer>(valueOperand)) {
-                    variable->set(std::make_shared<Integer>(intValue->value()));
-                }
-                else if (auto realValue = std::dynamic_pointer_cast<Real>(valueOperand)) {
-                    variable->set(std::make_shared<Real>(realValue->value()));
-                }
-                else {
-                    throw std::runtime_error("Error: Unsupported assignment operand type.");
-                }
 
-                operandStack.push(variable); // Push the variable with the new value back onto the stack
-            }
-            else if (is<Addition>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
+// evaluate() in slices.  The budget scope is re-established for every slice, since the
+// thread's current budget must not leak to the code that runs while this one is suspended.
+EvaluationTask RPNEvaluator::evaluate_async(TokenList rpnExpression, AsyncOptions options) {
+    co_await EvaluationTask::Configure{ options };
+    if (rpnExpression.empty()) {
+        throw std::runtime_error("Error: insufficient operands");
+    }
+    if (running_m) {
+        throw std::runtime_error("Error: an asynchronous evaluation is in progress");
+    }
+    running_m = true;
+    struct Running {
+        bool& running;
+        ~Running() { running = false; }
+    } const running{ running_m };
+
+    std::uint64_t const slice = std::max<std::uint64_t>(options.slice, 1);
+    budget_m.start();
+    {
+        EvaluationBudget::Scope budgetScope(budget_m);
+        if (auto result = fast_result(rpnExpression)) {
+            co_return result;
+        }
+    }
 
-                if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
-                    operandStack.push(std::make_shared<Integer>(leftInt->value() + rightInt->value()));
-                }
-                else {
-                    Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
-                    Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
-                    operandStack.push(std::make_shared<Real>(leftValue + rightValue));
-                }
-            }
-            else if (is<Subtraction>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
+    operand_stack operandStack;
+    std::uint64_t sliceEnd = slice;
+    for (auto const& token : rpnExpression) {
+        if (budget_m.operations() >= sliceEnd) {
+            co_await EvaluationTask::Yield{};
+            sliceEnd = budget_m.operations() + slice;
+        }
 
-                if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
-                    operandStack.push(std::make_shared<Integer>(leftInt->value() - rightInt->value()));
-                }
-                else {
-                    Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
-                    Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
-                    operandStack.push(std::make_shared<Real>(leftValue - rightValue));
-                }
+        // Large Integer factorials and powers are computed here, pausing between their steps.
+        bool stepped = false;
+        if (is<Factorial>(token) || is<Power>(token) || is<Pow>(token)) {
+            EvaluationBudget::Scope budgetScope(budget_m);
+            dereference_variables(operandStack, convert<Operation>(token)->number_of_args());
+            if (is<Factorial>(token)) {
+                auto const n = std::dynamic_pointer_cast<Integer>(operandStack.top());
+                stepped = n && n->value() > slice;
             }
-            else if (is<Multiplication>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-
-                if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
-                    operandStack.push(std::make_shared<Integer>(leftInt->value() * rightInt->value()));
-                }
-                else {
-                    Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
-                    Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
-                    operandStack.push(std::make_shared<Real>(leftValue * rightValue));
-                }
+            else {
+                auto const top = operandStack.top();
+                operandStack.pop();
+                auto const base = std::dynamic_pointer_cast<Integer>(operandStack.top());
+                operandStack.push(top);
+                auto const exponent = std::dynamic_pointer_cast<Integer>(top);
+                stepped = base && exponent && exponent->value() > 0 && exponent->value() <= std::numeric_limits<unsigned>::max()
+                    && boost::multiprecision::abs(base->value()) > 1
+                    && static_cast<double>(boost::multiprecision::msb(boost::multiprecision::abs(base->value()))) * exponent->value().convert_to<double>() > large_power_bits;
             }
-            else if (is<Division>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
+        }
+        if (!stepped) {
+            EvaluationBudget::Scope budgetScope(budget_m);
+            if (profiler_m && profiler_m->sample())
+                profiled_apply(token, operandStack);
+            else
+                apply(token, operandStack);
+            continue;
+        }
 
-                if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
-                    if (rightInt->value() == 0) throw std::runtime_error("Division by zero");
-                    operandStack.push(std::make_shared<Integer>(leftInt->value() / rightInt->value()));
-                }
-                else {
-                    Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
-                    Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
-                    if (rightValue == 0) throw std::runtime_error("Division by zero");
-                    operandStack.push(std::make_shared<Real>(leftValue / rightValue));
-                }
+        Integer::value_type result;
+        if (is<Factorial>(token)) {
+            std::uint64_t n;
+            {
+                EvaluationBudget::Scope budgetScope(budget_m);
+                budget_m.charge();
+                n = Integer::factorial_terms(convert<Integer>(operandStack.top())->value());
             }
-            else if (is<Modulus>(token)) {
-                auto right = pop_operand_from_stack<Integer>(operandStack);
-                auto left = pop_operand_from_stack<Integer>(operandStack);
-                operandStack.push(std::make_shared<Integer>(left % right));
-            }
-            else if (is<Power>(token)) {
-                auto exponent = operandStack.top(); operandStack.pop();
-                auto base = operandStack.top(); operandStack.pop();
-
-                if (auto baseInt = std::dynamic_pointer_cast<Integer>(base), exponentInt = std::dynamic_pointer_cast<Integer>(exponent); baseInt && exponentInt) {
-                    if (exponentInt->value() < 0) {
-                        operandStack.push(std::make_shared<Real>(Real::value_type(1.0) / boost::multiprecision::pow(static_cast<Real::value_type>(baseInt->value()), static_cast<unsigned int>(-exponentInt->value()))));
-                    }
-                    else {
-                        operandStack.push(std::make_shared<Integer>(boost::multiprecision::pow(baseInt->value(), static_cast<unsigned int>(exponentInt->value()))));
-                    }
+            operandStack.pop();
+            result = 1;
+            for (std::uint64_t first = 2; first <= n; ) {
+                std::uint64_t const last = n - first < slice ? n : first + slice - 1;
+                {
+                    EvaluationBudget::Scope budgetScope(budget_m);
+                    result *= Integer::product(first, last);
                 }
-                else {
-                    Real::value_type baseValue = (is<Integer>(base)) ? static_cast<Real::value_type>(convert<Integer>(base)->value()) : convert<Real>(base)->value();
-                    Real::value_type exponentValue = (is<Integer>(exponent)) ? static_cast<Real::value_type>(convert<Integer>(exponent)->value()) : convert<Real>(exponent)->value();
-                    operandStack.push(std::make_shared<Real>(boost::multiprecision::pow(baseValue, exponentValue)));
+                first = last + 1;
+                if (first <= n) {
+                    co_await EvaluationTask::Yield{};
                 }
             }
-            else if (is<And>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-
-                auto lhs = std::dynamic_pointer_cast<Boolean>(left);
-                auto rhs = std::dynamic_pointer_cast<Boolean>(right);
+        }
+        else {
+            auto const exponent = convert<Integer>(operandStack.top())->value();
+            operandStack.pop();
+            auto const base = convert<Integer>(operandStack.top())->value();
+            operandStack.pop();
+            std::optional<Integer::PowerSteps> steps;
+            {
+                EvaluationBudget::Scope budgetScope(budget_m);
+                budget_m.charge();
+                steps.emplace(base, exponent);
+            }
+            while (!steps->done()) {
+                {
+                    EvaluationBudget::Scope budgetScope(budget_m);
+                    steps->step();
+                }
+                if (!steps->done()) {
+                    co_await EvaluationTask::Yield{};
+                }
+            }
+            result = steps->result();
+        }
+        sliceEnd = budget_m.operations() + slice;
+        operandStack.push(std::make_shared<Integer>(std::move(result)));
+        EvaluationBudget::Scope budgetScope(budget_m);
+        check_result(operandStack);
+    }
 
-                if (!lhs || !rhs) {
-                    throw std::runtime_error("Error: AND operation requires boolean operands.");
-                }
+    if (operandStack.size() != 1) {
+        throw std::runtime_error("Error: too many operands");
+    }
 
-                operandStack.push(std::make_shared<Boolean>(lhs->value() && rhs->value()));
+    co_return operandStack.top();
 }
-            else if (is<Or>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
 
-                auto lhs = std::dynamic_pointer_cast<Boolean>(left);
-                auto rhs = std::dynamic_pointer_cast<Boolean>(right);
 
-                if (!lhs || !rhs) {
-                    throw std::runtime_error("Error: OR operation requires boolean operands.");
-                }
 
-                operandStack.push(std::make_shared<Boolean>(lhs->value() || rhs->value()));
+// The fast mode result, or nullptr if fast mode is off or cannot certify one.
+Operand::pointer_type RPNEvaluator::fast_result(TokenList const& rpnExpression) {
+    if (fastDigits_m != 0) {
+        TraceSpan span("fast mode");
+        if (auto bounds = IntervalEvaluator().evaluate(rpnExpression))
+            if (auto result = IntervalEvaluator::certify(*bounds, fastDigits_m)) {
+                ++fastCount_m;
+                return result;
             }
-            else if (is<Not>(token)) {
-                auto operand = operandStack.top();
-                operandStack.pop();
+        ++fallbackCount_m;
+    }
+    return nullptr;
+}
 
-                // Ensure operand is non-null and of Boolean type
-                if (!operand) {
-                    throw std::runtime_error("Error: Null operand encountered in NOT operation.");
-                }
 
-                std::shared_ptr<Boolean> value;
-                if (is<Variable>(operand)) {
-                    auto variable = std::dynamic_pointer_cast<Variable>(operand);
-                    if (!variable->value()) {
-                        throw std::runtime_error("Error: variable not initialized in NOT operation.");
-                    }
-                    value = std::dynamic_pointer_cast<Boolean>(variable->value());
-                }
-                else {
-                    value = std::dynamic_pointer_cast<Boolean>(operand);
-                }
 
-                if (!value) {
-                    throw std::runtime_error("Error: NOT operation requires a boolean operand.");
-                }
+// apply(), timed for the profiler along with the types of the operands it takes.
+void RPNEvaluator::profiled_apply(Token::pointer_type const& token, operand_stack& operandStack) {
+    auto const operation = std::dynamic_pointer_cast<Operation>(token);
+    if (!operation) {
+        apply(token, operandStack);
+        return;
+    }
 
-                operandStack.push(std::make_shared<Boolean>(!value->value()));
+    Operand::pointer_type first, second;
+    auto const args = operation->number_of_args();
+    if (args >= 2 && operandStack.size() >= 2) {
+        second = operandStack.top(); operandStack.pop();
+        first = operandStack.top();
+        operandStack.push(second);
+    }
+    else if (args >= 1 && !operandStack.empty()) {
+        first = operandStack.top();
+    }
 
-            }
-            else if (is<Nand>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-                auto lhs = std::dynamic_pointer_cast<Boolean>(left);
-                auto rhs = std::dynamic_pointer_cast<Boolean>(right);
+    auto const start = std::chrono::steady_clock::now();
+    apply(token, operandStack);
+    profiler_m->record(*token, first.get(), second.get(), std::chrono::steady_clock::now() - start);
+}
 
-                if (!lhs || !rhs) {
-                    throw std::runtime_error("Error: Null operand encountered in Nand operation.");
-                }
 
-                operandStack.push(std::make_shared<Boolean>(!(lhs->value() && rhs->value())));
-            }
-            else if (is<Nor>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-                auto lhs = std::dynamic_pointer_cast<Boolean>(left);
-                auto rhs = std::dynamic_pointer_cast<Boolean>(right);
 
-                if (!lhs || !rhs) {
-                    throw std::runtime_error("Error: Null operand encountered in Nor operation.");
-                }
+// Applies one RPN token to the operand stack.
+void RPNEvaluator::apply(Token::pointer_type const& token, operand_stack& operandStack) {
+    budget_m.charge();
+    if (is<Operation>(token) && !is<Assignment>(token)) {
+        dereference_variables(operandStack, convert<Operation>(token)->number_of_args());
+    }
 
-                operandStack.push(std::make_shared<Boolean>(!(lhs->value() || rhs->value())));
+    if (is<Operand>(token)) {
+        operandStack.push(convert<Operand>(token));
+    }
+    else if (is<Operator>(token)) {
+        if (is<Identity>(token)) {
+            auto value = operandStack.top(); operandStack.pop();
+            if (auto intValue = std::dynamic_pointer_cast<Integer>(value)) {
+                operandStack.push(std::make_shared<Integer>(intValue->value()));
             }
-            else if (is<Xor>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-                auto lhs = std::dynamic_pointer_cast<Boolean>(left);
-                auto rhs = std::dynamic_pointer_cast<Boolean>(right);
-
-                if (!lhs || !rhs) {
-                    throw std::runtime_error("Error: Null operand encountered in Xor operation.");
-                }
-
-                operandStack.push(std::make_shared<Boolean>(lhs->value() != rhs->value()));
+            else if (auto realValue = std::dynamic_pointer_cast<Real>(value)) {
+                operandStack.push(std::make_shared<Real>(realValue->value()));
+            }
+            else {
+                throw std::runtime_error("Invalid operand type for identity");
             }
-            else if (is<Xnor>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-                auto lhs = std::dynamic_pointer_cast<Boolean>(left);
-                auto rhs = std::dynamic_pointer_cast<Boolean>(right);
+        }
+        else if (is<Negation>(token)) {
+            auto operand = operandStack.top();
+            operandStack.pop();
 
-                if (!lhs || !rhs) {
-                    throw std::runtime_error("Error: Null operand encountered in Xnor operation.");
+            if (auto var = std::dynamic_pointer_cast<Variable>(operand)) {
+                if (!var->value()) {  // Check if the variable has been assigned a value
+                    throw std::runtime_error("Error: variable not initialized");
                 }
-
-                operandStack.push(std::make_shared<Boolean>(lhs->value() == rhs->value()));
             }
-            else if (is<Equality>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
 
-                if (!left || !right) {
-                    throw std::runtime_error("Error: Null operand encountered in Equality operation.");
-                }
+            // Proceed with negation if operand is an Integer or Real
+            if (auto intValue = std::dynamic_pointer_cast<Integer>(operand)) {
+                operandStack.push(std::make_shared<Integer>(-intValue->value()));
+            }
+            else if (auto realValue = std::dynamic_pointer_cast<Real>(operand)) {
+                operandStack.push(std::make_shared<Real>(-realValue->value()));
+            }
+            else {
+                throw std::runtime_error("Invalid operand type for negation");
+            }
+        }
+        else if (is<Assignment>(token)) {
+            dereference_variables(operandStack, 1);
+            auto valueOperand = operandStack.top(); operandStack.pop();
+            auto variableOperand = operandStack.top(); operandStack.pop();
 
-                bool result = (is<Integer>(left) && is<Integer>(right))
-                    ? convert<Integer>(left)->value() == convert<Integer>(right)->value()
-                    : (is<Real>(left) && is<Real>(right))
-                    ? convert<Real>(left)->value() == convert<Real>(right)->value()
-                    : (is<Boolean>(left) && is<Boolean>(right))
-                    ? convert<Boolean>(left)->value() == convert<Boolean>(right)->value()
-                    : (is<Integer>(left) && is<Real>(right))
-                    ? static_cast<Real::value_type>(convert<Integer>(left)->value()) == convert<Real>(right)->value()
-                    : (is<Real>(left) && is<Integer>(right))
-                    ? convert<Real>(left)->value() == static_cast<Real::value_type>(convert<Integer>(right)->value())
-                    : throw std::runtime_error("Unsupported operand types for Equality");
-
-                operandStack.push(std::make_shared<Boolean>(result));
-                }
-            else if (is<Inequality>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
+            auto variable = std::dynamic_pointer_cast<Variable>(variableOperand);
+            if (!variable) {
+                throw std::runtime_error("Error: assignment to a non-variable.");
+            }
 
-                if (!left || !right) {
-                    throw std::runtime_error("Error: Null operand encountered in Inequality operation.");
-                }
+            // Ensure the value is properly assigned based on operand type
+            if (auto boolValue = std::dynamic_pointer_cast<Boolean>(valueOperand)) {
+                variable->set(std::make_shared<Boolean>(boolValue->value()));
+            }
+            else if (auto intValue = std::dynamic_pointer_cast<Integer>(valueOperand)) {
+                variable->set(std::make_shared<Integer>(intValue->value()));
+            }
+            else if (auto realValue = std::dynamic_pointer_cast<Real>(valueOperand)) {
+                variable->set(std::make_shared<Real>(realValue->value()));
+            }
+            else {
+                throw std::runtime_error("Error: Unsupported assignment operand type.");
+            }
 
-                bool result = (is<Integer>(left) && is<Integer>(right))
-                    ? convert<Integer>(left)->value() != convert<Integer>(right)->value()
-                    : (is<Real>(left) && is<Real>(right))
-                    ? convert<Real>(left)->value() != convert<Real>(right)->value()
-                    : (is<Boolean>(left) && is<Boolean>(right))
-                    ? convert<Boolean>(left)->value() != convert<Boolean>(right)->value()
-                    : (is<Integer>(left) && is<Real>(right))
-                    ? static_cast<Real::value_type>(convert<Integer>(left)->value()) != convert<Real>(right)->value()
-                    : (is<Real>(left) && is<Integer>(right))
-                    ? convert<Real>(left)->value() != static_cast<Real::value_type>(convert<Integer>(right)->value())
-                    : throw std::runtime_error("Unsupported operand types for Inequality");
-
-                operandStack.push(std::make_shared<Boolean>(result));
-            }
-            else if (is<Greater>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-
-                if (!left || !right) {
-                    throw std::runtime_error("Error: Null operand encountered in Greater operation.");
-                }
+            operandStack.push(variable); // Push the variable with the new value back onto the stack
+        }
+        else if (is<Addition>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
 
-                bool result = (is<Integer>(left) && is<Integer>(right))
-                    ? convert<Integer>(left)->value() > convert<Integer>(right)->value()
-                    : (is<Real>(left) && is<Real>(right))
-                    ? convert<Real>(left)->value() > convert<Real>(right)->value()
-                    : (is<Integer>(left) && is<Real>(right))
-                    ? static_cast<Real::value_type>(convert<Integer>(left)->value()) > convert<Real>(right)->value()
-                    : (is<Real>(left) && is<Integer>(right))
-                    ? convert<Real>(left)->value() > static_cast<Real::value_type>(convert<Integer>(right)->value())
-                    : (is<Boolean>(left) && is<Boolean>(right))
-                    ? (convert<Boolean>(left)->value() ? 1 : 0) > (convert<Boolean>(right)->value() ? 1 : 0)
-                    : throw std::runtime_error("Unsupported operand types for Greater");
-
-                operandStack.push(std::make_shared<Boolean>(result));
-            }
-            else if (is<GreaterEqual>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-
-                if (!left || !right) {
-                    throw std::runtime_error("Error: Null operand encountered in GreaterEqual operation.");
-                }
+            if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
+                operandStack.push(std::make_shared<Integer>(leftInt->value() + rightInt->value()));
+            }
+            else {
+                Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
+                Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
+                operandStack.push(std::make_shared<Real>(leftValue + rightValue));
+            }
+        }
+        else if (is<Subtraction>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
 
-                bool result = (is<Integer>(left) && is<Integer>(right))
-                    ? convert<Integer>(left)->value() >= convert<Integer>(right)->value()
-                    : (is<Real>(left) && is<Real>(right))
-                    ? convert<Real>(left)->value() >= convert<Real>(right)->value()
-                    : (is<Integer>(left) && is<Real>(right))
-                    ? static_cast<Real::value_type>(convert<Integer>(left)->value()) >= convert<Real>(right)->value()
-                    : (is<Real>(left) && is<Integer>(right))
-                    ? convert<Real>(left)->value() >= static_cast<Real::value_type>(convert<Integer>(right)->value())
-                    : (is<Boolean>(left) && is<Boolean>(right))
-                    ? (convert<Boolean>(left)->value() ? 1 : 0) >= (convert<Boolean>(right)->value() ? 1 : 0)
-                    : throw std::runtime_error("Unsupported operand types for GreaterEqual");
-
-                operandStack.push(std::make_shared<Boolean>(result));
-            }
-            else if (is<Less>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-
-                if (!left || !right) {
-                    throw std::runtime_error("Error: Null operand encountered in Less operation.");
-                }
+            if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
+                operandStack.push(std::make_shared<Integer>(leftInt->value() - rightInt->value()));
+            }
+            else {
+                Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
+                Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
+                operandStack.push(std::make_shared<Real>(leftValue - rightValue));
+            }
+        }
+        else if (is<Multiplication>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
 
-                bool result = (is<Integer>(left) && is<Integer>(right))
-                    ? convert<Integer>(left)->value() < convert<Integer>(right)->value()
-                    : (is<Real>(left) && is<Real>(right))
-                    ? convert<Real>(left)->value() < convert<Real>(right)->value()
-                    : (is<Integer>(left) && is<Real>(right))
-                    ? static_cast<Real::value_type>(convert<Integer>(left)->value()) < convert<Real>(right)->value()
-                    : (is<Real>(left) && is<Integer>(right))
-                    ? convert<Real>(left)->value() < static_cast<Real::value_type>(convert<Integer>(right)->value())
-                    : (is<Boolean>(left) && is<Boolean>(right))
-                    ? (convert<Boolean>(left)->value() ? 1 : 0) < (convert<Boolean>(right)->value() ? 1 : 0)
-                    : throw std::runtime_error("Unsupported operand types for Less");
-
-                operandStack.push(std::make_shared<Boolean>(result));
-            }
-            else if (is<LessEqual>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
-
-                if (!left || !right) {
-                    throw std::runtime_error("Error: Null operand encountered in LessEqual operation.");
+            if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
+                if (budget_m.limits().bits != 0 && leftInt->value() != 0 && rightInt->value() != 0) {
+                    budget_m.check_bits(static_cast<double>(boost::multiprecision::msb(boost::multiprecision::abs(leftInt->value())))
+                        + static_cast<double>(boost::multiprecision::msb(boost::multiprecision::abs(rightInt->value()))) + 1);
                 }
-
-                bool result = (is<Integer>(left) && is<Integer>(right))
-                    ? convert<Integer>(left)->value() <= convert<Integer>(right)->value()
-                    : (is<Real>(left) && is<Real>(right))
-                    ? convert<Real>(left)->value() <= convert<Real>(right)->value()
-                    : (is<Integer>(left) && is<Real>(right))
-                    ? static_cast<Real::value_type>(convert<Integer>(left)->value()) <= convert<Real>(right)->value()
-                    : (is<Real>(left) && is<Integer>(right))
-                    ? convert<Real>(left)->value() <= static_cast<Real::value_type>(convert<Integer>(right)->value())
-                    : (is<Boolean>(left) && is<Boolean>(right))
-                    ? (convert<Boolean>(left)->value() ? 1 : 0) <= (convert<Boolean>(right)->value() ? 1 : 0)
-                    : throw std::runtime_error("Unsupported operand types for LessEqual");
-
-                operandStack.push(std::make_shared<Boolean>(result));
-            }
-            else if (is<Factorial>(token)) {
-                auto value = pop_operand_from_stack<Integer>(operandStack);
-                operandStack.push(std::make_shared<Integer>(Integer::factorial(value)));
+                operandStack.push(std::make_shared<Integer>(leftInt->value() * rightInt->value()));
             }
             else {
-                throw std::runtime_error("Unsupported operator");
+                Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
+                Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
+                operandStack.push(std::make_shared<Real>(leftValue * rightValue));
             }
         }
-        else if (is<Function>(token)) {
-            // Handle single-argument functions
-            if (is<Abs>(token)) {
-                auto value = operandStack.top();
-                operandStack.pop();
-                if (auto intValue = std::dynamic_pointer_cast<Integer>(value)) {
-                    operandStack.push(std::make_shared<Integer>(boost::multiprecision::abs(intValue->value())));
-                }
-                else if (auto realValue = std::dynamic_pointer_cast<Real>(value)) {
-                    operandStack.push(std::make_shared<Real>(boost::multiprecision::abs(realValue->value())));
-                }
-                else {
-                    throw std::runtime_error("Invalid operand type for absolute value");
-                }
+        else if (is<Division>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
+                if (rightInt->value() == 0) throw std::runtime_error("Division by zero");
+                operandStack.push(std::make_shared<Integer>(leftInt->value() / rightInt->value()));
             }
-            else if (is<Arccos>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::acos(value)));
+            else {
+                Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
+                Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
+                if (rightValue == 0) throw std::runtime_error("Division by zero");
+                operandStack.push(std::make_shared<Real>(leftValue / rightValue));
             }
-            else if (is<Arcsin>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::asin(value)));
+        }
+        else if (is<Modulus>(token)) {
+            auto right = pop_operand_from_stack<Integer>(operandStack);
+            auto left = pop_operand_from_stack<Integer>(operandStack);
+            operandStack.push(std::make_shared<Integer>(left % right));
+        }
+        else if (is<Power>(token)) {
+            auto exponent = operandStack.top(); operandStack.pop();
+            auto base = operandStack.top(); operandStack.pop();
+
+            if (auto baseInt = std::dynamic_pointer_cast<Integer>(base), exponentInt = std::dynamic_pointer_cast<Integer>(exponent); baseInt && exponentInt) {
+                operandStack.push(integer_power(baseInt->value(), exponentInt->value()));
             }
-            else if (is<Arctan>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::atan(value)));
+            else {
+                Real::value_type baseValue = (is<Integer>(base)) ? static_cast<Real::value_type>(convert<Integer>(base)->value()) : convert<Real>(base)->value();
+                Real::value_type exponentValue = (is<Integer>(exponent)) ? static_cast<Real::value_type>(convert<Integer>(exponent)->value()) : convert<Real>(exponent)->value();
+                operandStack.push(std::make_shared<Real>(boost::multiprecision::pow(baseValue, exponentValue)));
             }
-            else if (is<Ceil>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::ceil(value)));
+        }
+        else if (is<And>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            auto lhs = std::dynamic_pointer_cast<Boolean>(left);
+            auto rhs = std::dynamic_pointer_cast<Boolean>(right);
+
+            if (!lhs || !rhs) {
+                throw std::runtime_error("Error: AND operation requires boolean operands.");
             }
-            else if (is<Floor>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::floor(value)));
+
+            operandStack.push(std::make_shared<Boolean>(lhs->value() && rhs->value()));
             }
-            else if (is<Ln>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::log(value)));
+        else if (is<Or>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            auto lhs = std::dynamic_pointer_cast<Boolean>(left);
+            auto rhs = std::dynamic_pointer_cast<Boolean>(right);
+
+            if (!lhs || !rhs) {
+                throw std::runtime_error("Error: OR operation requires boolean operands.");
             }
-            else if (is<Lb>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::log2(value)));
+
+            operandStack.push(std::make_shared<Boolean>(lhs->value() || rhs->value()));
+        }
+        else if (is<Not>(token)) {
+            auto operand = operandStack.top();
+            operandStack.pop();
+
+            // Ensure operand is non-null and of Boolean type
+            if (!operand) {
+                throw std::runtime_error("Error: Null operand encountered in NOT operation.");
             }
-            else if (is<Sin>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::sin(value)));
+
+            std::shared_ptr<Boolean> value;
+            if (is<Variable>(operand)) {
+                auto variable = std::dynamic_pointer_cast<Variable>(operand);
+                if (!variable->value()) {
+                    throw std::runtime_error("Error: variable not initialized in NOT operation.");
+                }
+                value = std::dynamic_pointer_cast<Boolean>(variable->value());
             }
-            else if (is<Cos>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::cos(value)));
+            else {
+                value = std::dynamic_pointer_cast<Boolean>(operand);
             }
-            else if (is<Tan>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::tan(value)));
+
+            if (!value) {
+                throw std::runtime_error("Error: NOT operation requires a boolean operand.");
             }
-            else if (is<Sqrt>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::sqrt(value)));
+
+            operandStack.push(std::make_shared<Boolean>(!value->value()));
+
+        }
+        else if (is<Nand>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+            auto lhs = std::dynamic_pointer_cast<Boolean>(left);
+            auto rhs = std::dynamic_pointer_cast<Boolean>(right);
+
+            if (!lhs || !rhs) {
+                throw std::runtime_error("Error: Null operand encountered in Nand operation.");
             }
-            else if (is<Exp>(token)) {
-                auto value = pop_operand_from_stack<Real>(operandStack);
-                operandStack.push(std::make_shared<Real>(boost::multiprecision::exp(value)));
+
+            operandStack.push(std::make_shared<Boolean>(!(lhs->value() && rhs->value())));
+        }
+        else if (is<Nor>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+            auto lhs = std::dynamic_pointer_cast<Boolean>(left);
+            auto rhs = std::dynamic_pointer_cast<Boolean>(right);
+
+            if (!lhs || !rhs) {
+                throw std::runtime_error("Error: Null operand encountered in Nor operation.");
             }
-            else if (is<Arctan2>(token)) {
-                auto x_operand = std::dynamic_pointer_cast<Real>(operandStack.top());
-                operandStack.pop();
-                auto y_operand = std::dynamic_pointer_cast<Real>(operandStack.top());
-                operandStack.pop();
 
-                Real::value_type result_value = boost::multiprecision::atan2(
-                    static_cast<Real::value_type>(y_operand->value()),
-                    static_cast<Real::value_type>(x_operand->value())
-                );
+            operandStack.push(std::make_shared<Boolean>(!(lhs->value() || rhs->value())));
+        }
+        else if (is<Xor>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+            auto lhs = std::dynamic_pointer_cast<Boolean>(left);
+            auto rhs = std::dynamic_pointer_cast<Boolean>(right);
 
-                operandStack.push(std::make_shared<Real>(result_value));
+            if (!lhs || !rhs) {
+                throw std::runtime_error("Error: Null operand encountered in Xor operation.");
             }
-            else if (is<Max>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
 
-                if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
-                    operandStack.push(std::make_shared<Integer>(std::max(leftInt->value(), rightInt->value())));
-                }
-                else {
-                    Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
-                    Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
-                    operandStack.push(std::make_shared<Real>(std::max(leftValue, rightValue)));
-                }
+            operandStack.push(std::make_shared<Boolean>(lhs->value() != rhs->value()));
+        }
+        else if (is<Xnor>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+            auto lhs = std::dynamic_pointer_cast<Boolean>(left);
+            auto rhs = std::dynamic_pointer_cast<Boolean>(right);
+
+            if (!lhs || !rhs) {
+                throw std::runtime_error("Error: Null operand encountered in Xnor operation.");
             }
-            else if (is<Min>(token)) {
-                auto right = operandStack.top(); operandStack.pop();
-                auto left = operandStack.top(); operandStack.pop();
 
-                if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
-                    operandStack.push(std::make_shared<Integer>(std::min(leftInt->value(), rightInt->value())));
-                }
-                else {
-                    Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
-                    Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
-                    operandStack.push(std::make_shared<Real>(std::min(leftValue, rightValue)));
-                }
+            operandStack.push(std::make_shared<Boolean>(lhs->value() == rhs->value()));
+        }
+        else if (is<Equality>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            if (!left || !right) {
+                throw std::runtime_error("Error: Null operand encountered in Equality operation.");
+            }
+
+            bool result = (is<Integer>(left) && is<Integer>(right))
+                ? convert<Integer>(left)->value() == convert<Integer>(right)->value()
+                : (is<Real>(left) && is<Real>(right))
+                ? convert<Real>(left)->value() == convert<Real>(right)->value()
+                : (is<Boolean>(left) && is<Boolean>(right))
+                ? convert<Boolean>(left)->value() == convert<Boolean>(right)->value()
+                : (is<Integer>(left) && is<Real>(right))
+                ? static_cast<Real::value_type>(convert<Integer>(left)->value()) == convert<Real>(right)->value()
+                : (is<Real>(left) && is<Integer>(right))
+                ? convert<Real>(left)->value() == static_cast<Real::value_type>(convert<Integer>(right)->value())
+                : throw std::runtime_error("Unsupported operand types for Equality");
+
+            operandStack.push(std::make_shared<Boolean>(result));
+            }
+        else if (is<Inequality>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            if (!left || !right) {
+                throw std::runtime_error("Error: Null operand encountered in Inequality operation.");
+            }
+
+            bool result = (is<Integer>(left) && is<Integer>(right))
+                ? convert<Integer>(left)->value() != convert<Integer>(right)->value()
+                : (is<Real>(left) && is<Real>(right))
+                ? convert<Real>(left)->value() != convert<Real>(right)->value()
+                : (is<Boolean>(left) && is<Boolean>(right))
+                ? convert<Boolean>(left)->value() != convert<Boolean>(right)->value()
+                : (is<Integer>(left) && is<Real>(right))
+                ? static_cast<Real::value_type>(convert<Integer>(left)->value()) != convert<Real>(right)->value()
+                : (is<Real>(left) && is<Integer>(right))
+                ? convert<Real>(left)->value() != static_cast<Real::value_type>(convert<Integer>(right)->value())
+                : throw std::runtime_error("Unsupported operand types for Inequality");
+
+            operandStack.push(std::make_shared<Boolean>(result));
+        }
+        else if (is<Greater>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            if (!left || !right) {
+                throw std::runtime_error("Error: Null operand encountered in Greater operation.");
+            }
+
+            bool result = (is<Integer>(left) && is<Integer>(right))
+                ? convert<Integer>(left)->value() > convert<Integer>(right)->value()
+                : (is<Real>(left) && is<Real>(right))
+                ? convert<Real>(left)->value() > convert<Real>(right)->value()
+                : (is<Integer>(left) && is<Real>(right))
+                ? static_cast<Real::value_type>(convert<Integer>(left)->value()) > convert<Real>(right)->value()
+                : (is<Real>(left) && is<Integer>(right))
+                ? convert<Real>(left)->value() > static_cast<Real::value_type>(convert<Integer>(right)->value())
+                : (is<Boolean>(left) && is<Boolean>(right))
+                ? (convert<Boolean>(left)->value() ? 1 : 0) > (convert<Boolean>(right)->value() ? 1 : 0)
+                : throw std::runtime_error("Unsupported operand types for Greater");
+
+            operandStack.push(std::make_shared<Boolean>(result));
+        }
+        else if (is<GreaterEqual>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            if (!left || !right) {
+                throw std::runtime_error("Error: Null operand encountered in GreaterEqual operation.");
+            }
+
+            bool result = (is<Integer>(left) && is<Integer>(right))
+                ? convert<Integer>(left)->value() >= convert<Integer>(right)->value()
+                : (is<Real>(left) && is<Real>(right))
+                ? convert<Real>(left)->value() >= convert<Real>(right)->value()
+                : (is<Integer>(left) && is<Real>(right))
+                ? static_cast<Real::value_type>(convert<Integer>(left)->value()) >= convert<Real>(right)->value()
+                : (is<Real>(left) && is<Integer>(right))
+                ? convert<Real>(left)->value() >= static_cast<Real::value_type>(convert<Integer>(right)->value())
+                : (is<Boolean>(left) && is<Boolean>(right))
+                ? (convert<Boolean>(left)->value() ? 1 : 0) >= (convert<Boolean>(right)->value() ? 1 : 0)
+                : throw std::runtime_error("Unsupported operand types for GreaterEqual");
+
+            operandStack.push(std::make_shared<Boolean>(result));
+        }
+        else if (is<Less>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            if (!left || !right) {
+                throw std::runtime_error("Error: Null operand encountered in Less operation.");
+            }
+
+            bool result = (is<Integer>(left) && is<Integer>(right))
+                ? convert<Integer>(left)->value() < convert<Integer>(right)->value()
+                : (is<Real>(left) && is<Real>(right))
+                ? convert<Real>(left)->value() < convert<Real>(right)->value()
+                : (is<Integer>(left) && is<Real>(right))
+                ? static_cast<Real::value_type>(convert<Integer>(left)->value()) < convert<Real>(right)->value()
+                : (is<Real>(left) && is<Integer>(right))
+                ? convert<Real>(left)->value() < static_cast<Real::value_type>(convert<Integer>(right)->value())
+                : (is<Boolean>(left) && is<Boolean>(right))
+                ? (convert<Boolean>(left)->value() ? 1 : 0) < (convert<Boolean>(right)->value() ? 1 : 0)
+                : throw std::runtime_error("Unsupported operand types for Less");
+
+            operandStack.push(std::make_shared<Boolean>(result));
+        }
+        else if (is<LessEqual>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            if (!left || !right) {
+                throw std::runtime_error("Error: Null operand encountered in LessEqual operation.");
+            }
+
+            bool result = (is<Integer>(left) && is<Integer>(right))
+                ? convert<Integer>(left)->value() <= convert<Integer>(right)->value()
+                : (is<Real>(left) && is<Real>(right))
+                ? convert<Real>(left)->value() <= convert<Real>(right)->value()
+                : (is<Integer>(left) && is<Real>(right))
+                ? static_cast<Real::value_type>(convert<Integer>(left)->value()) <= convert<Real>(right)->value()
+                : (is<Real>(left) && is<Integer>(right))
+                ? convert<Real>(left)->value() <= static_cast<Real::value_type>(convert<Integer>(right)->value())
+                : (is<Boolean>(left) && is<Boolean>(right))
+                ? (convert<Boolean>(left)->value() ? 1 : 0) <= (convert<Boolean>(right)->value() ? 1 : 0)
+                : throw std::runtime_error("Unsupported operand types for LessEqual");
+
+            operandStack.push(std::make_shared<Boolean>(result));
+        }
+        else if (is<Factorial>(token)) {
+            auto value = pop_operand_from_stack<Integer>(operandStack);
+            operandStack.push(std::make_shared<Integer>(Integer::factorial(value)));
+        }
+        else {
+            throw std::runtime_error("Unsupported operator");
+        }
+    }
+    else if (is<Function>(token)) {
+        // Handle single-argument functions
+        if (is<Abs>(token)) {
+            auto value = operandStack.top();
+            operandStack.pop();
+            if (auto intValue = std::dynamic_pointer_cast<Integer>(value)) {
+                operandStack.push(std::make_shared<Integer>(boost::multiprecision::abs(intValue->value())));
+            }
+            else if (auto realValue = std::dynamic_pointer_cast<Real>(value)) {
+                operandStack.push(std::make_shared<Real>(boost::multiprecision::abs(realValue->value())));
+            }
+            else {
+                throw std::runtime_error("Invalid operand type for absolute value");
+            }
+        }
+        else if (is<Arccos>(token)) {
+            TraceSpan span("acos", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(boost::multiprecision::acos(value)));
+        }
+        else if (is<Arcsin>(token)) {
+            TraceSpan span("asin", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(boost::multiprecision::asin(value)));
+        }
+        else if (is<Arctan>(token)) {
+            TraceSpan span("atan", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(real_kernels::atan(value)));
+        }
+        else if (is<Ceil>(token)) {
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(boost::multiprecision::ceil(value)));
+        }
+        else if (is<Floor>(token)) {
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(boost::multiprecision::floor(value)));
+        }
+        else if (is<Ln>(token)) {
+            TraceSpan span("ln", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(real_kernels::log(value)));
+        }
+        else if (is<Lb>(token)) {
+            TraceSpan span("lb", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(real_kernels::log2(value)));
+        }
+        else if (is<Log>(token)) {
+            TraceSpan span("log", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(real_kernels::log10(value)));
+        }
+        else if (is<Sin>(token)) {
+            TraceSpan span("sin", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(boost::multiprecision::sin(value)));
+        }
+        else if (is<Cos>(token)) {
+            TraceSpan span("cos", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(boost::multiprecision::cos(value)));
+        }
+        else if (is<Tan>(token)) {
+            TraceSpan span("tan", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(boost::multiprecision::tan(value)));
+        }
+        else if (is<Sqrt>(token)) {
+            TraceSpan span("sqrt", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(boost::multiprecision::sqrt(value)));
+        }
+        else if (is<Exp>(token)) {
+            TraceSpan span("exp", "kernel");
+            auto value = pop_operand_from_stack<Real>(operandStack);
+            operandStack.push(std::make_shared<Real>(real_kernels::exp(value)));
+        }
+        else if (is<Arctan2>(token)) {
+            TraceSpan span("atan2", "kernel");
+            auto x_operand = std::dynamic_pointer_cast<Real>(operandStack.top());
+            operandStack.pop();
+            auto y_operand = std::dynamic_pointer_cast<Real>(operandStack.top());
+            operandStack.pop();
+
+            Real::value_type result_value = real_kernels::atan2(
+                static_cast<Real::value_type>(y_operand->value()),
+                static_cast<Real::value_type>(x_operand->value())
+            );
+
+            operandStack.push(std::make_shared<Real>(result_value));
+        }
+        else if (is<Max>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
+
+            if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
+                operandStack.push(std::make_shared<Integer>(std::max(leftInt->value(), rightInt->value())));
+            }
+            else {
+                Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
+                Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
+                operandStack.push(std::make_shared<Real>(std::max(leftValue, rightValue)));
             }
-            else if (is<Pow>(token)) {
-                auto exponent = operandStack.top(); operandStack.pop();
-                auto base = operandStack.top(); operandStack.pop();
+        }
+        else if (is<Min>(token)) {
+            auto right = operandStack.top(); operandStack.pop();
+            auto left = operandStack.top(); operandStack.pop();
 
-                if (auto baseInt = std::dynamic_pointer_cast<Integer>(base), exponentInt = std::dynamic_pointer_cast<Integer>(exponent); baseInt && exponentInt) {
-                    // Integer ^ Integer
-                    operandStack.push(std::make_shared<Integer>(boost::multiprecision::pow(baseInt->value(), static_cast<unsigned int>(exponentInt->value()))));
-                }
-                else {
-                    // Convert operands to Real if they are not both Integer
-                    Real::value_type baseValue = (is<Integer>(base)) ? static_cast<Real::value_type>(convert<Integer>(base)->value()) : convert<Real>(base)->value();
-                    Real::value_type exponentValue = (is<Integer>(exponent)) ? static_cast<Real::value_type>(convert<Integer>(exponent)->value()) : convert<Real>(exponent)->value();
-                    operandStack.push(std::make_shared<Real>(boost::multiprecision::pow(baseValue, exponentValue)));
-                }
+            if (auto leftInt = std::dynamic_pointer_cast<Integer>(left), rightInt = std::dynamic_pointer_cast<Integer>(right); leftInt && rightInt) {
+                operandStack.push(std::make_shared<Integer>(std::min(leftInt->value(), rightInt->value())));
             }
             else {
-                throw std::runtime_error("Unsupported function");
+                Real::value_type leftValue = (is<Integer>(left)) ? static_cast<Real::value_type>(convert<Integer>(left)->value()) : convert<Real>(left)->value();
+                Real::value_type rightValue = (is<Integer>(right)) ? static_cast<Real::value_type>(convert<Integer>(right)->value()) : convert<Real>(right)->value();
+                operandStack.push(std::make_shared<Real>(std::min(leftValue, rightValue)));
+            }
+        }
+        else if (is<Pow>(token)) {
+            auto exponent = operandStack.top(); operandStack.pop();
+            auto base = operandStack.top(); operandStack.pop();
+
+            if (auto baseInt = std::dynamic_pointer_cast<Integer>(base), exponentInt = std::dynamic_pointer_cast<Integer>(exponent); baseInt && exponentInt) {
+                // Integer ^ Integer
+                operandStack.push(integer_power(baseInt->value(), exponentInt->value()));
+            }
+            else {
+                // Convert operands to Real if they are not both Integer
+                Real::value_type baseValue = (is<Integer>(base)) ? static_cast<Real::value_type>(convert<Integer>(base)->value()) : convert<Real>(base)->value();
+                Real::value_type exponentValue = (is<Integer>(exponent)) ? static_cast<Real::value_type>(convert<Integer>(exponent)->value()) : convert<Real>(exponent)->value();
+                operandStack.push(std::make_shared<Real>(boost::multiprecision::pow(baseValue, exponentValue)));
             }
         }
         else {
-            throw std::runtime_error("Unknown token type encountered");
+            throw std::runtime_error("Unsupported function");
         }
     }
+    else {
+        throw std::runtime_error("Unknown token type encountered");
+    }
 
-    if (operandStack.size() != 1) {
-        throw std::runtime_error("Error: too many operands");
+    if (is<Operation>(token)) {
+        check_result(operandStack);
     }
+}
 
-    return operandStack.top();
+
+
+// Checks the budget after an operation: the deadline, and the size of an Integer result.
+void RPNEvaluator::check_result(operand_stack const& operandStack) {
+    budget_m.check();       // Real functions have no checkpoints of their own
+    if (budget_m.limits().bits != 0 && !operandStack.empty()) {
+        if (auto integer = std::dynamic_pointer_cast<Integer>(operandStack.top()); integer && integer->value() != 0) {
+            budget_m.check_bits(static_cast<double>(boost::multiprecision::msb(boost::multiprecision::abs(integer->value()))) + 1);
+        }
+    }
 }
\ No newline at end of file
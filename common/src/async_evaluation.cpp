@@ -0,0 +1,152 @@
+/*! \file async_evaluation.cpp
+    \brief EvaluationTask and EvaluationScheduler implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/async_evaluation.hpp>
+#include <ee/evaluation_budget.hpp>
+#include <stdexcept>
+#include <utility>
+
+
+
+void EvaluationScheduler::post(std::coroutine_handle<> evaluation, int priority) {
+    ready_m.emplace(priority, evaluation);       // after the others of equal priority
+}
+
+
+
+bool EvaluationScheduler::remove(std::coroutine_handle<> evaluation) {
+    for (auto it = ready_m.begin(); it != ready_m.end(); ++it)
+        if (it->second == evaluation) {
+            ready_m.erase(it);
+            return true;
+        }
+    return false;
+}
+
+
+
+bool EvaluationScheduler::run_one() {
+    if (ready_m.empty())
+        return false;
+    auto const evaluation = ready_m.begin()->second;
+    ready_m.erase(ready_m.begin());
+    evaluation.resume();
+    return true;
+}
+
+
+
+std::size_t EvaluationScheduler::run() {
+    std::size_t slices = 0;
+    while (run_one())
+        ++slices;
+    return slices;
+}
+
+
+
+EvaluationScheduler& EvaluationScheduler::this_thread() {
+    thread_local EvaluationScheduler scheduler;
+    return scheduler;
+}
+
+
+
+bool EvaluationTask::Configure::await_suspend(handle self) noexcept {
+    auto& promise = self.promise();
+    promise.scheduler = options.scheduler ? options.scheduler : &EvaluationScheduler::this_thread();
+    promise.priority = options.priority;
+    return false;
+}
+
+
+
+bool EvaluationTask::Yield::await_suspend(handle evaluation) noexcept {
+    self = evaluation;
+    auto& promise = evaluation.promise();
+    if (promise.cancelled)
+        return false;
+    promise.scheduler->post(evaluation, promise.priority);
+    promise.queued = true;
+    return true;
+}
+
+
+
+void EvaluationTask::Yield::await_resume() {
+    auto& promise = self.promise();
+    promise.queued = false;
+    if (promise.cancelled)
+        throw BudgetExceeded(BudgetExceeded::Limit::cancelled, "Error: evaluation cancelled");
+}
+
+
+
+EvaluationTask& EvaluationTask::operator = (EvaluationTask&& other) noexcept {
+    if (this != &other) {
+        EvaluationTask old(std::move(*this));
+        handle_m = std::exchange(other.handle_m, {});
+    }
+    return *this;
+}
+
+
+
+EvaluationTask::~EvaluationTask() {
+    if (!handle_m)
+        return;
+    if (handle_m.promise().queued)
+        handle_m.promise().scheduler->remove(handle_m);
+    handle_m.destroy();
+}
+
+
+
+Operand::pointer_type EvaluationTask::get() const {
+    if (!handle_m)
+        throw std::logic_error("Error: no evaluation");
+    if (!handle_m.done())
+        throw std::logic_error("Error: evaluation not finished");
+    auto const& promise = handle_m.promise();
+    if (promise.error)
+        std::rethrow_exception(promise.error);
+    return promise.result;
+}
+
+
+
+void EvaluationTask::cancel() {
+    if (done())
+        return;
+    auto& promise = handle_m.promise();
+    promise.cancelled = true;
+    if (promise.queued) {
+        promise.scheduler->remove(handle_m);
+        handle_m.resume();      // throws out of the evaluation and resumes its awaiter, if any
+    }
+}
+
+
+
+void EvaluationTask::set_priority(int priority) {
+    if (done())
+        return;
+    auto& promise = handle_m.promise();
+    promise.priority = priority;
+    if (promise.queued) {
+        promise.scheduler->remove(handle_m);
+        promise.scheduler->post(handle_m, priority);
+    }
+}
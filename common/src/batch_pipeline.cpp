@@ -0,0 +1,151 @@
+/*! \file batch_pipeline.cpp
+    \brief BatchPipeline class implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/batch_pipeline.hpp>
+#include <ee/batch_io.hpp>
+#include <ee/spsc_queue.hpp>
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace {
+    /*! Lines are passed between stages in chunks, so the queue cost is paid per chunk rather than per line. */
+    constexpr std::size_t chunk_size = 256;
+
+    /*! Reader to parser: one non-blank line. */
+    struct Line {
+        std::size_t number = 0;
+        std::string text;
+    };
+
+    /*! Parser to evaluator: the RPN, or the reason there is none. */
+    struct Parsed {
+        std::size_t number = 0;
+        TokenList   rpn;
+        std::string error;
+    };
+
+    /*! Evaluator to writer: the output line. */
+    struct Output {
+        std::string text;
+        bool        failed = false;
+    };
+
+    /*! An empty chunk marks the end of the input. */
+    template <typename T>
+    using Chunk = std::vector<T>;
+
+    [[nodiscard]] std::string error_line(std::size_t number, char const* message) {
+        return "Error: line " + std::to_string(number) + ": " + message + "\n";
+    }
+}
+
+
+
+std::size_t BatchPipeline::run(std::FILE* input, std::FILE* output) {
+    auto const queueChunks = std::max<std::size_t>(1, capacity_m / chunk_size);
+    SpscQueue<Chunk<Line>> lines(queueChunks);
+    SpscQueue<Chunk<Parsed>> parsed(queueChunks);
+    SpscQueue<Chunk<Output>> results(queueChunks);
+
+    std::thread reader([&] {
+        std::size_t number = 0;
+        Chunk<Line> chunk;
+        for_each_line(input, [&](std::string_view text) {
+            ++number;
+            if (std::all_of(text.begin(), text.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; }))
+                return;
+            chunk.push_back(Line{ number, std::string(text) });
+            if (chunk.size() == chunk_size)
+                lines.push(std::exchange(chunk, {}));
+        });
+        if (!chunk.empty())
+            lines.push(std::move(chunk));
+        lines.push({});
+    });
+
+    std::thread parser([&] {
+        for (auto in = lines.pop(); !in.empty(); in = lines.pop()) {
+            Chunk<Parsed> out;
+            out.reserve(in.size());
+            for (auto& line : in) {
+                Parsed p{ line.number, {}, {} };
+                try {
+                    p.rpn = evaluator_m.compile(line.text);
+                }
+                catch (std::exception const& ex) {
+                    p.error = ex.what();
+                }
+                catch (...) {
+                    p.error = "unknown error";
+                }
+                out.push_back(std::move(p));
+            }
+            parsed.push(std::move(out));
+        }
+        parsed.push({});
+    });
+
+    std::thread evaluator([&] {
+        for (auto in = parsed.pop(); !in.empty(); in = parsed.pop()) {
+            Chunk<Output> out;
+            out.reserve(in.size());
+            for (auto& p : in) {
+                if (!p.error.empty()) {
+                    out.push_back(Output{ error_line(p.number, p.error.c_str()), true });
+                    continue;
+                }
+                try {
+                    out.push_back(Output{ evaluator_m.run(p.rpn)->str() + "\n", false });
+                }
+                catch (std::exception const& ex) {
+                    out.push_back(Output{ error_line(p.number, ex.what()), true });
+                }
+                catch (...) {
+                    out.push_back(Output{ error_line(p.number, "unknown error"), true });
+                }
+            }
+            results.push(std::move(out));
+        }
+        results.push({});
+    });
+
+    lines_m = failures_m = 0;
+    {
+        BufferedWriter writer(output);
+        for (auto in = results.pop(); !in.empty(); in = results.pop()) {
+            for (auto const& out : in) {
+                ++lines_m;
+                if (out.failed)
+                    ++failures_m;
+                writer.write(out.text);
+            }
+        }
+        writer.flush();
+        if (writer.failed())
+            ++failures_m;
+    }
+
+    reader.join();
+    parser.join();
+    evaluator.join();
+    if (std::ferror(input))
+        ++failures_m;
+    return failures_m;
+}
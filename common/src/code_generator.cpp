@@ -0,0 +1,418 @@
+/*! \file code_generator.cpp
+    \brief CodeGenerator class implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/code_generator.hpp>
+#include <ee/tokenizer.hpp>
+#include <ee/parser.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/boolean.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+#include <ee/operator.hpp>
+#include <ee/function.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace {
+    using string_type = CodeGenerator::string_type;
+    using Types = CodeGenerator::Types;
+
+    enum class Kind { integer, real, boolean };
+
+    /*! A generation-time stack entry: C++ code and its type, plus the value while it is still a literal. */
+    struct Node {
+        string_type             code;
+        Kind                    kind;
+        Operand::pointer_type   literal;
+    };
+
+    [[nodiscard]] char const* type_name(Kind kind) {
+        switch (kind) {
+        case Kind::integer: return "Integer";
+        case Kind::real:    return "Real";
+        default:            return "Boolean";
+        }
+    }
+
+    [[nodiscard]] bool is_numeric(Node const& n) { return n.kind != Kind::boolean; }
+
+    /*! 'text' made safe to place inside a comment. */
+    [[nodiscard]] string_type comment(string_type text) {
+        for (std::size_t pos; (pos = text.find("*/")) != string_type::npos; )
+            text.replace(pos, 2, "* /");
+        return text;
+    }
+
+    /*! Names that cannot be used as parameters or functions in the generated header. */
+    [[nodiscard]] bool is_reserved(string_type const& name) {
+        static std::set<string_type> const reserved = {
+            "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break",
+            "case", "catch", "char", "class", "co_await", "co_return", "co_yield", "compl", "concept",
+            "const", "consteval", "constexpr", "constinit", "const_cast", "continue", "decltype",
+            "default", "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export",
+            "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "long",
+            "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or",
+            "or_eq", "private", "protected", "public", "register", "reinterpret_cast", "requires",
+            "return", "short", "signed", "sizeof", "static", "static_assert", "static_cast", "struct",
+            "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef", "typeid",
+            "typename", "union", "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while",
+            "xor", "xor_eq", "std", "boost", "detail", "Integer", "Real", "Boolean"
+        };
+        return reserved.count(name) != 0;
+    }
+
+
+    /*! Translates one RPN token list; constants that need a definition are appended to 'constants'. */
+    class Translator {
+        Types                               types_m;
+        std::vector<string_type>&           constants_m;
+        std::map<Token const*, string_type> parameters_m;
+        std::ostringstream                  body_m;
+        unsigned                            temporaries_m = 0;
+
+    public:
+        Translator(Types types, std::vector<string_type>& constants) : types_m(types), constants_m(constants) { }
+
+        void add_parameter(Token const* variable, string_type const& name) { parameters_m[variable] = name; }
+
+        [[nodiscard]] string_type body() const { return body_m.str(); }
+
+        [[nodiscard]] Kind translate(TokenList const& rpnExpression);
+
+    private:
+        [[nodiscard]] bool native() const { return types_m == Types::native; }
+
+        /*! A math function name for the selected types. */
+        [[nodiscard]] string_type fn(char const* name) const {
+            return (native() ? "std::" : "boost::multiprecision::") + string_type(name);
+        }
+
+        /*! Code for a folded literal. */
+        [[nodiscard]] string_type literal_code(Operand::pointer_type const& value) {
+            if (is<Boolean>(value))
+                return convert<Boolean>(value)->value() ? "true" : "false";
+
+            if (is<Integer>(value)) {
+                auto const& n = convert<Integer>(value)->value();
+                bool const small = n >= std::numeric_limits<long long>::min() && n <= std::numeric_limits<long long>::max();
+                if (small)
+                    return native() ? n.str() + "LL" : "Integer(" + n.str() + "LL)";
+                if (native())
+                    throw std::runtime_error("Error: Integer constant does not fit in long long; use the multiprecision types.");
+                return define("Integer", n.str());
+            }
+
+            auto const& x = convert<Real>(value)->value();
+            if (native()) {
+                double const d = x.convert_to<double>();
+                if (!std::isfinite(d))
+                    throw std::runtime_error("Error: Real constant does not fit in double; use the multiprecision types.");
+                std::ostringstream oss;
+                oss << std::setprecision(std::numeric_limits<double>::max_digits10) << d;
+                auto s = oss.str();
+                if (s.find_first_of(".en") == string_type::npos)
+                    s += ".0";
+                return s;
+            }
+            return define("Real", x.str(std::numeric_limits<Real::value_type>::digits10, std::ios_base::scientific));
+        }
+
+        /*! Defines a namespace-scope constant parsed from 'digits' once, rather than on every call. */
+        [[nodiscard]] string_type define(char const* type, string_type const& digits) {
+            auto const name = "c" + std::to_string(constants_m.size());
+            constants_m.push_back("inline " + string_type(type) + " const " + name + "(\"" + digits + "\");");
+            return "detail::" + name;
+        }
+
+        /*! Code for 'n' as a Real. */
+        [[nodiscard]] string_type real(Node const& n) {
+            return n.kind == Kind::integer ? "Real(" + n.code + ")" : n.code;
+        }
+
+        /*! Emits a local holding 'code' and returns the node referring to it. */
+        [[nodiscard]] Node emit(Kind kind, string_type const& code) {
+            auto const name = "t" + std::to_string(temporaries_m++);
+            body_m << "\t\t" << type_name(kind) << " const " << name << " = " << code << ";\n";
+            return Node{ name, kind, nullptr };
+        }
+    };
+
+
+
+    Kind Translator::translate(TokenList const& rpnExpression) {
+        std::vector<Node> stack;
+
+        for (auto const& token : rpnExpression) {
+            if (is<Variable>(token)) {
+                stack.push_back(Node{ parameters_m.at(token.get()), Kind::real, nullptr });
+                continue;
+            }
+            if (is<Boolean>(token) || is<Integer>(token) || is<Real>(token)) {
+                auto const value = convert<Operand>(token);
+                stack.push_back(Node{ string_type(), is<Boolean>(token) ? Kind::boolean : is<Integer>(token) ? Kind::integer : Kind::real, value });
+                continue;
+            }
+            if (!is<Operator>(token) && !is<Function>(token))
+                throw std::runtime_error("Error: the expression cannot be compiled (result() and pseudo-operations are not supported).");
+            if (is<Assignment>(token))
+                throw std::runtime_error("Error: the expression cannot be compiled (assignment is not supported).");
+
+            auto const arity = convert<Operation>(token)->number_of_args();
+            if (stack.size() < arity)
+                throw std::runtime_error("Error: insufficient operands");
+            std::vector<Node> args(stack.end() - arity, stack.end());
+            stack.erase(stack.end() - arity, stack.end());
+
+            // literal operands only: fold with the exact evaluator
+            if (std::all_of(args.begin(), args.end(), [](Node const& n) { return n.literal != nullptr; })) {
+                TokenList sub;
+                for (auto const& a : args)
+                    sub.push_back(a.literal);
+                sub.push_back(token);
+                auto const value = RPNEvaluator().evaluate(sub);
+                if (!is<Boolean>(value) && !is<Integer>(value) && !is<Real>(value))
+                    throw std::runtime_error("Error: the expression cannot be compiled.");
+                stack.push_back(Node{ string_type(), is<Boolean>(value) ? Kind::boolean : is<Integer>(value) ? Kind::integer : Kind::real, value });
+                continue;
+            }
+
+            for (auto& a : args)
+                if (a.literal)
+                    a.code = literal_code(a.literal);
+
+            auto const requireNumeric = [&args](char const* what) {
+                for (auto const& a : args)
+                    if (!is_numeric(a))
+                        throw std::runtime_error(string_type("Error: ") + what + " requires numeric operands.");
+            };
+            auto const requireBoolean = [&args](char const* what) {
+                for (auto const& a : args)
+                    if (a.kind != Kind::boolean)
+                        throw std::runtime_error(string_type("Error: ") + what + " requires boolean operands.");
+            };
+            auto const requireReal = [&args](char const* what) {
+                for (auto const& a : args)
+                    if (a.kind != Kind::real)
+                        throw std::runtime_error(string_type("Invalid operand type: ") + what + " requires a Real operand.");
+            };
+            // both numeric (promoted to Real) or both Boolean
+            auto const comparison = [&](char const* op, char const* what) {
+                if (is_numeric(args[0]) != is_numeric(args[1]))
+                    throw std::runtime_error(string_type("Unsupported operand types for ") + what);
+                auto const lhs = is_numeric(args[0]) ? real(args[0]) : args[0].code;
+                auto const rhs = is_numeric(args[1]) ? real(args[1]) : args[1].code;
+                return emit(Kind::boolean, lhs + " " + op + " " + rhs);
+            };
+            auto const binary = [&](char const* op, char const* what) {
+                requireNumeric(what);
+                return emit(Kind::real, real(args[0]) + " " + op + " " + real(args[1]));
+            };
+            auto const unary = [&](string_type const& function, char const* what) {
+                requireReal(what);
+                return emit(Kind::real, function + "(" + args[0].code + ")");
+            };
+
+            Node result;
+            if (is<Identity>(token)) {
+                requireNumeric("identity");
+                result = args[0];
+            }
+            else if (is<Negation>(token)) {
+                requireNumeric("negation");
+                result = emit(args[0].kind, "-" + args[0].code);
+            }
+            else if (is<Not>(token)) {
+                requireBoolean("NOT");
+                result = emit(Kind::boolean, "!" + args[0].code);
+            }
+            else if (is<Factorial>(token))	throw std::runtime_error("Invalid operand type: factorial requires an Integer operand.");
+            else if (is<Modulus>(token))	throw std::runtime_error("Invalid operand type: modulus requires Integer operands.");
+            else if (is<Addition>(token))		result = binary("+", "addition");
+            else if (is<Subtraction>(token))	result = binary("-", "subtraction");
+            else if (is<Multiplication>(token))	result = binary("*", "multiplication");
+            else if (is<Division>(token)) {
+                requireNumeric("division");
+                result = emit(Kind::real, "detail::divide(" + real(args[0]) + ", " + real(args[1]) + ")");
+            }
+            else if (is<Power>(token) || is<Pow>(token)) {
+                requireNumeric("power");
+                result = emit(Kind::real, fn("pow") + "(" + real(args[0]) + ", " + real(args[1]) + ")");
+            }
+            else if (is<And>(token) || is<Or>(token) || is<Nand>(token) || is<Nor>(token) || is<Xor>(token) || is<Xnor>(token)) {
+                requireBoolean("a logical operation");
+                auto const& a = args[0].code;
+                auto const& b = args[1].code;
+                string_type code =
+                    is<And>(token) ? a + " && " + b :
+                    is<Or>(token) ? a + " || " + b :
+                    is<Nand>(token) ? "!(" + a + " && " + b + ")" :
+                    is<Nor>(token) ? "!(" + a + " || " + b + ")" :
+                    is<Xor>(token) ? a + " != " + b :
+                    a + " == " + b;
+                result = emit(Kind::boolean, code);
+            }
+            else if (is<Equality>(token))		result = comparison("==", "Equality");
+            else if (is<Inequality>(token))		result = comparison("!=", "Inequality");
+            else if (is<Greater>(token))		result = comparison(">", "Greater");
+            else if (is<GreaterEqual>(token))	result = comparison(">=", "GreaterEqual");
+            else if (is<Less>(token))			result = comparison("<", "Less");
+            else if (is<LessEqual>(token))		result = comparison("<=", "LessEqual");
+            else if (is<Abs>(token)) {
+                requireNumeric("abs");
+                result = emit(args[0].kind, fn("abs") + "(" + args[0].code + ")");
+            }
+            else if (is<Arccos>(token))	result = unary(fn("acos"), "arccos");
+            else if (is<Arcsin>(token))	result = unary(fn("asin"), "arcsin");
+            else if (is<Arctan>(token))	result = unary(fn("atan"), "arctan");
+            else if (is<Ceil>(token))	result = unary(fn("ceil"), "ceil");
+            else if (is<Floor>(token))	result = unary(fn("floor"), "floor");
+            else if (is<Cos>(token))	result = unary(fn("cos"), "cos");
+            else if (is<Sin>(token))	result = unary(fn("sin"), "sin");
+            else if (is<Tan>(token))	result = unary(fn("tan"), "tan");
+            else if (is<Exp>(token))	result = unary(fn("exp"), "exp");
+            else if (is<Ln>(token))		result = unary(fn("log"), "ln");
+            else if (is<Lb>(token))		result = unary(native() ? "std::log2" : "detail::log2", "lb");
+            else if (is<Log>(token))	result = unary(fn("log10"), "log");
+            else if (is<Sqrt>(token))	result = unary(fn("sqrt"), "sqrt");
+            else if (is<Arctan2>(token)) {
+                requireReal("arctan2");
+                result = emit(Kind::real, fn("atan2") + "(" + args[0].code + ", " + args[1].code + ")");
+            }
+            else if (is<Max>(token) || is<Min>(token)) {
+                requireNumeric(is<Max>(token) ? "max" : "min");
+                result = emit(Kind::real, string_type(is<Max>(token) ? "std::max" : "std::min") + "(" + real(args[0]) + ", " + real(args[1]) + ")");
+            }
+            else
+                throw std::runtime_error("Error: the expression cannot be compiled (unsupported operation).");
+
+            stack.push_back(result);
+        }
+
+        if (stack.size() != 1)
+            throw std::runtime_error("Error: too many operands");
+
+        auto& last = stack.back();
+        if (last.literal)
+            last.code = literal_code(last.literal);
+        body_m << "\t\treturn " << last.code << ";\n";
+        return last.kind;
+    }
+}
+
+
+
+CodeGenerator::Function const& CodeGenerator::add(string_type const& name, string_type const& expression) {
+    static std::regex const identifier("[A-Za-z_][A-Za-z0-9_]*");
+    if (!std::regex_match(name, identifier) || is_reserved(name))
+        throw std::runtime_error("Error: '" + name + "' is not a usable function name.");
+    for (auto const& f : functions_m)
+        if (f.name == name)
+            throw std::runtime_error("Error: function '" + name + "' is already defined.");
+
+    Tokenizer tokenizer;
+    auto const infix = tokenizer.tokenize(expression);
+    auto const rpn = Parser().parse(infix);
+
+    std::map<Token const*, string_type> names;
+    for (auto const& [ident, variable] : tokenizer.variables())
+        names[variable.get()] = is_reserved(ident) ? ident + "_" : ident;
+
+    // constants are only kept if the whole expression translates
+    auto constants = constants_m;
+    Translator translator(types_m, constants);
+    Function f{ name, expression, {}, {} };
+    for (auto const& token : infix)
+        if (is<Variable>(token) && std::find(f.parameters.begin(), f.parameters.end(), names.at(token.get())) == f.parameters.end()) {
+            translator.add_parameter(token.get(), names.at(token.get()));
+            f.parameters.push_back(names.at(token.get()));
+        }
+
+    auto const kind = translator.translate(rpn);
+    std::ostringstream oss;
+    oss << "\t[[nodiscard]] inline " << type_name(kind) << " " << name << "(";
+    for (std::size_t i = 0; i < f.parameters.size(); ++i)
+        oss << (i ? ", " : "") << (types_m == Types::native ? "Real const " : "Real const& ") << f.parameters[i];
+    oss << ") {\n" << translator.body() << "\t}\n";
+    f.body = oss.str();
+
+    constants_m = std::move(constants);
+    functions_m.push_back(std::move(f));
+    return functions_m.back();
+}
+
+
+
+CodeGenerator::string_type CodeGenerator::header(string_type const& ns) const {
+    bool const native = types_m == Types::native;
+    std::ostringstream oss;
+
+    oss << "#pragma once\n"
+        << "/*!\tGenerated by ee-compile; do not edit.\n\n";
+    for (auto const& f : functions_m)
+        oss << "\t" << f.name << ": " << comment(f.expression) << "\n";
+    oss << "*/\n\n";
+
+    oss << "#include <algorithm>\n";
+    if (native)
+        oss << "#include <cmath>\n";
+    else
+        oss << "#include <boost/multiprecision/cpp_dec_float.hpp>\n"
+            << "#include <boost/multiprecision/cpp_int.hpp>\n";
+    oss << "#include <stdexcept>\n\n\n";
+
+    oss << "namespace " << ns << " {\n";
+    if (native)
+        oss << "\tusing Integer = long long;\n"
+            << "\tusing Real = double;\n";
+    else
+        oss << "\tusing Integer = boost::multiprecision::cpp_int;\n"
+            << "\tusing Real = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<1000, int32_t, void>>;\n";
+    oss << "\tusing Boolean = bool;\n\n";
+
+    oss << "\tnamespace detail {\n";
+    if (native) {
+        oss << "\t\t[[nodiscard]] inline Real divide(Real const a, Real const b) {\n"
+            << "\t\t\tif (b == 0) throw std::runtime_error(\"Division by zero\");\n"
+            << "\t\t\treturn a / b;\n"
+            << "\t\t}\n";
+    }
+    else {
+        oss << "\t\t[[nodiscard]] inline Real divide(Real const& a, Real const& b) {\n"
+            << "\t\t\tif (b == 0) throw std::runtime_error(\"Division by zero\");\n"
+            << "\t\t\treturn a / b;\n"
+            << "\t\t}\n"
+            << "\t\t[[nodiscard]] inline Real log2(Real const& x) {\n"
+            << "\t\t\tstatic Real const ln2 = boost::multiprecision::log(Real(2));\n"
+            << "\t\t\treturn boost::multiprecision::log(x) / ln2;\n"
+            << "\t\t}\n";
+        for (auto const& c : constants_m)
+            oss << "\t\t" << c << "\n";
+    }
+    oss << "\t}\n";
+
+    for (auto const& f : functions_m)
+        oss << "\n\t/*! " << comment(f.expression) << " */\n" << f.body;
+    oss << "}\n";
+    return oss.str();
+}
@@ -0,0 +1,235 @@
+/*! \file csv_evaluator.cpp
+    \brief CsvEvaluator class implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+    EECOL input and output.
+
+============================================================= */
+
+#include <ee/csv_evaluator.hpp>
+#include <ee/batch_io.hpp>
+#include <ee/csv.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace {
+    /*! A row of the current chunk. */
+    struct Row {
+        std::size_t                         number = 0;
+        std::vector<Operand::pointer_type>  values;
+        std::string                         error;
+    };
+
+    /*! Collects the results in the output format. */
+    class ResultSink {
+        CsvEvaluator::Format    format_m;
+        BufferedWriter          text_m;
+        EecolWriter             eecol_m;
+        std::FILE*              file_m;
+        std::string             chunk_m;
+
+    public:
+        ResultSink(std::FILE* file, CsvEvaluator::Format format, std::string const& name, EecolType type, int scale)
+            : format_m(format), text_m(file), file_m(file) {
+            if (format_m == CsvEvaluator::Format::csv)
+                text_m.write(csv::quoted(name) + "\n");
+            else
+                eecol_m.add_column(name, type, scale);
+        }
+
+        /*! Appends a result, or an error for row 'label'.  Returns false if the row failed. */
+        bool add(Token::pointer_type const& result, std::string const& error, std::string const& label) {
+            if (format_m == CsvEvaluator::Format::csv) {
+                chunk_m += error.empty() ? result->str() : csv::quoted("Error: " + label + ": " + error);
+                chunk_m += '\n';
+                return error.empty();
+            }
+            if (!error.empty()) {
+                eecol_m.push_null(0);
+                return false;
+            }
+            try {
+                eecol_m.push_operand(0, result);
+                return true;
+            }
+            catch (std::exception const&) {
+                eecol_m.push_null(0);
+                return false;
+            }
+        }
+
+        void end_chunk() {
+            text_m.write(chunk_m);
+            chunk_m.clear();
+        }
+
+        /*! Writes the output; returns false on a write error. */
+        bool finish() {
+            if (format_m == CsvEvaluator::Format::eecol) {
+                try {
+                    eecol_m.write(file_m);
+                }
+                catch (std::exception const&) {
+                    return false;
+                }
+            }
+            text_m.flush();
+            return !text_m.failed();
+        }
+    };
+
+    /*! Evaluates the rows of 'chunk' into 'sink'. */
+    void evaluate_chunk(ExpressionEvaluator& evaluator, TokenList const& rpn, std::vector<CsvEvaluator::Column> const& columns,
+                        std::vector<Row>& chunk, char const* unit, ResultSink& sink, std::size_t& rows, std::size_t& failures) {
+        for (auto& row : chunk) {
+            ++rows;
+            Token::pointer_type result;
+            if (row.error.empty()) {
+                try {
+                    for (std::size_t c = 0; c < columns.size(); ++c)
+                        convert<Variable>(columns[c].variable)->set(row.values[c]);
+                    result = evaluator.run(rpn);
+                    if (auto const variable = std::dynamic_pointer_cast<Variable>(result))
+                        result = variable->value();
+                }
+                catch (std::exception const& ex) {
+                    row.error = ex.what();
+                }
+                catch (...) {
+                    row.error = "unknown error";
+                }
+            }
+            if (!sink.add(result, row.error, std::string(unit) + " " + std::to_string(row.number)))
+                ++failures;
+        }
+        sink.end_chunk();
+        chunk.clear();
+    }
+}
+
+
+
+CsvEvaluator::CsvEvaluator(std::string_view formula) : rpn_m(evaluator_m.compile(formula)) { }
+
+
+
+void CsvEvaluator::bind(std::vector<std::string_view> const& names) {
+    columns_m.clear();
+    for (auto const& [name, variable] : evaluator_m.variables()) {
+        auto const found = std::find(names.begin(), names.end(), name);
+        if (found == names.end())
+            throw std::runtime_error("Error: no column named '" + name + "'");
+        columns_m.push_back(Column{ name, static_cast<std::size_t>(found - names.begin()), ColumnType::integer, variable });
+    }
+    std::sort(columns_m.begin(), columns_m.end(), [](Column const& a, Column const& b) { return a.field < b.field; });
+}
+
+
+
+std::size_t CsvEvaluator::run(std::string_view text, std::FILE* output, Format format, std::string const& resultName) {
+    std::vector<std::string_view> fields;
+    std::size_t headerLine;
+    auto const data = csv::split_header(text, fields, headerLine);
+    bind(fields);
+
+    // a column holds Reals if any of its numeric fields is not an integer
+    for_each_line(data, [&](std::string_view line) {
+        if (csv::trim(line).empty())
+            return;
+        csv::split_fields(line, fields);
+        for (auto& column : columns_m) {
+            if (column.field >= fields.size())
+                continue;
+            auto const number = csv::classify(fields[column.field]);
+            if (number == csv::Number::fixed || number == csv::Number::real)
+                column.type = ColumnType::real;
+        }
+    });
+
+    rows_m = failures_m = 0;
+    ResultSink sink(output, format, resultName, resultType_m, resultScale_m);
+    std::vector<Row> chunk;
+    std::size_t lineNumber = headerLine;
+    for_each_line(data, [&](std::string_view line) {
+        ++lineNumber;
+        if (csv::trim(line).empty())
+            return;
+        csv::split_fields(line, fields);
+        Row row{ lineNumber, {}, {} };
+        row.values.reserve(columns_m.size());
+        for (auto const& column : columns_m) {
+            if (column.field >= fields.size() || fields[column.field].empty()) {
+                row.error = "missing value for '" + column.name + "'";
+                break;
+            }
+            auto const field = fields[column.field];
+            if (csv::classify(field) == csv::Number::none) {
+                row.error = "'" + std::string(field) + "' in column '" + column.name + "' is not a number";
+                break;
+            }
+            try {
+                if (column.type == ColumnType::integer)
+                    row.values.push_back(std::make_shared<Integer>(Integer::value_type(csv::integer_digits(field))));
+                else
+                    row.values.push_back(std::make_shared<Real>(Real::value_type(std::string(field.front() == '+' ? field.substr(1) : field))));
+            }
+            catch (std::exception const& ex) {
+                row.error = ex.what();
+                break;
+            }
+        }
+        chunk.push_back(std::move(row));
+        if (chunk.size() == chunk_rows)
+            evaluate_chunk(evaluator_m, rpn_m, columns_m, chunk, "line", sink, rows_m, failures_m);
+    });
+    evaluate_chunk(evaluator_m, rpn_m, columns_m, chunk, "line", sink, rows_m, failures_m);
+
+    return sink.finish() ? failures_m : failures_m + 1;
+}
+
+
+
+std::size_t CsvEvaluator::run(EecolReader const& input, std::FILE* output, Format format, std::string const& resultName) {
+    std::vector<std::string_view> names;
+    for (auto const& column : input.columns())
+        names.push_back(column.name);
+    bind(names);
+    for (auto& column : columns_m) {
+        auto const type = input.columns()[column.field].type;
+        column.type = type == EecolType::boolean ? ColumnType::boolean
+            : type == EecolType::int64 || type == EecolType::bignum ? ColumnType::integer
+            : ColumnType::real;
+    }
+
+    rows_m = failures_m = 0;
+    ResultSink sink(output, format, resultName, resultType_m, resultScale_m);
+    std::vector<Row> chunk;
+    for (std::size_t r = 0; r < input.rows(); ++r) {
+        Row row{ r + 1, {}, {} };
+        row.values.reserve(columns_m.size());
+        for (auto const& column : columns_m) {
+            auto value = input.operand(column.field, r);
+            if (!value) {
+                row.error = "missing value for '" + column.name + "'";
+                break;
+            }
+            row.values.push_back(std::move(value));
+        }
+        chunk.push_back(std::move(row));
+        if (chunk.size() == chunk_rows)
+            evaluate_chunk(evaluator_m, rpn_m, columns_m, chunk, "row", sink, rows_m, failures_m);
+    }
+    evaluate_chunk(evaluator_m, rpn_m, columns_m, chunk, "row", sink, rows_m, failures_m);
+
+    return sink.finish() ? failures_m : failures_m + 1;
+}
@@ -0,0 +1,665 @@
+/*! \file eecol.cpp
+    \brief EecolWriter and EecolReader implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/eecol.hpp>
+#include <ee/batch_io.hpp>
+#include <ee/boolean.hpp>
+#include <ee/csv.hpp>
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+static_assert(std::endian::native == std::endian::little, "EECOL files are only supported on little-endian hosts");
+
+
+namespace {
+    constexpr char magic[8] = { 'E', 'E', 'C', 'O', 'L', 0, 0, 1 };
+    constexpr std::uint32_t version = 1;
+    constexpr std::size_t header_size = 64;
+    constexpr std::size_t entry_size = 64;
+    constexpr std::size_t block_alignment = 64;
+
+    [[nodiscard]] std::size_t align(std::size_t offset) {
+        return (offset + block_alignment - 1) / block_alignment * block_alignment;
+    }
+
+    [[nodiscard]] std::size_t bitmap_size(std::size_t rows) {
+        return (rows + 7) / 8;
+    }
+
+    void set_bit(std::vector<std::uint8_t>& bits, std::size_t i, bool value) {
+        if (bits.size() <= i / 8)
+            bits.resize(i / 8 + 1);
+        if (value)
+            bits[i / 8] |= static_cast<std::uint8_t>(1u << (i % 8));
+    }
+
+    [[nodiscard]] bool get_bit(std::uint8_t const* bits, std::size_t i) {
+        return (bits[i / 8] >> (i % 8)) & 1u;
+    }
+
+    template <typename T>
+    void put(unsigned char* p, T value) {
+        std::memcpy(p, &value, sizeof value);
+    }
+
+    template <typename T>
+    [[nodiscard]] T get(char const* p) {
+        T value;
+        std::memcpy(&value, p, sizeof value);
+        return value;
+    }
+
+    /*! 10^scale as a Real. */
+    [[nodiscard]] Real::value_type power_of_ten(int scale) {
+        return Real::value_type("1e" + std::to_string(scale));
+    }
+}
+
+
+
+char const* to_string(EecolType type) {
+    switch (type) {
+    case EecolType::boolean:    return "boolean";
+    case EecolType::int64:      return "int64";
+    case EecolType::bignum:     return "bignum";
+    case EecolType::float64:    return "float64";
+    case EecolType::decimal:    return "decimal";
+    }
+    return "unknown";
+}
+
+
+
+EecolType parse_eecol_type(std::string_view text, int& scale) {
+    scale = 0;
+    if (text == "boolean") return EecolType::boolean;
+    if (text == "int64") return EecolType::int64;
+    if (text == "bignum") return EecolType::bignum;
+    if (text == "float64") return EecolType::float64;
+    if (text.substr(0, 8) == "decimal:") {
+        auto const digits = text.substr(8);
+        auto const [end, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), scale);
+        if (ec == std::errc() && end == digits.data() + digits.size() && scale >= 0 && scale <= 1000)
+            return EecolType::decimal;
+    }
+    throw std::runtime_error("Error: unknown column type '" + std::string(text) + "'");
+}
+
+
+
+// ==================== EecolWriter ====================
+
+std::size_t EecolWriter::add_column(std::string name, EecolType type, int scale) {
+    if (type == EecolType::decimal && (scale < 0 || scale > 1000))
+        throw std::runtime_error("Error: decimal scale must be 0 to 1000");
+    columns_m.push_back(Column{ std::move(name), type, type == EecolType::decimal ? scale : 0 });
+    return columns_m.size() - 1;
+}
+
+
+
+EecolWriter::Column& EecolWriter::next(std::size_t column, bool valid) {
+    auto& c = columns_m.at(column);
+    set_bit(c.validity, c.rows, valid);
+    c.hasNull = c.hasNull || !valid;
+    ++c.rows;
+    return c;
+}
+
+
+
+void EecolWriter::push_magnitude(Column& c, Integer::value_type const& value) {
+    export_bits(Integer::value_type(boost::multiprecision::abs(value)), std::back_inserter(c.limbs), 64, false);
+    c.index.push_back(c.limbs.size());
+    set_bit(c.bits, c.rows - 1, value < 0);
+}
+
+
+
+void EecolWriter::push_null(std::size_t column) {
+    auto& c = next(column, false);
+    switch (c.type) {
+    case EecolType::boolean:    set_bit(c.bits, c.rows - 1, false); break;
+    case EecolType::int64:      c.int64s.push_back(0); break;
+    case EecolType::float64:    c.doubles.push_back(0.0); break;
+    case EecolType::bignum:
+    case EecolType::decimal:    c.index.push_back(c.limbs.size()); set_bit(c.bits, c.rows - 1, false); break;
+    }
+}
+
+
+
+void EecolWriter::push_boolean(std::size_t column, bool value) {
+    if (columns_m.at(column).type != EecolType::boolean)
+        throw std::runtime_error("Error: column is not boolean");
+    auto& c = next(column, true);
+    set_bit(c.bits, c.rows - 1, value);
+}
+
+
+
+void EecolWriter::push_int64(std::size_t column, std::int64_t value) {
+    if (columns_m.at(column).type != EecolType::int64)
+        throw std::runtime_error("Error: column is not int64");
+    next(column, true).int64s.push_back(value);
+}
+
+
+
+void EecolWriter::push_bignum(std::size_t column, Integer::value_type const& value) {
+    if (columns_m.at(column).type != EecolType::bignum)
+        throw std::runtime_error("Error: column is not bignum");
+    push_magnitude(next(column, true), value);
+}
+
+
+
+void EecolWriter::push_float64(std::size_t column, double value) {
+    if (columns_m.at(column).type != EecolType::float64)
+        throw std::runtime_error("Error: column is not float64");
+    next(column, true).doubles.push_back(value);
+}
+
+
+
+void EecolWriter::push_decimal(std::size_t column, Real::value_type const& value) {
+    auto const& c = columns_m.at(column);
+    if (c.type != EecolType::decimal)
+        throw std::runtime_error("Error: column is not decimal");
+    auto text = boost::multiprecision::round(value * power_of_ten(c.scale)).str(0, std::ios_base::fixed);
+    text = text.substr(0, text.find('.'));
+    push_magnitude(next(column, true), Integer::value_type(text));
+}
+
+
+
+void EecolWriter::push_decimal(std::size_t column, std::string_view text) {
+    auto const& c = columns_m.at(column);
+    if (c.type != EecolType::decimal)
+        throw std::runtime_error("Error: column is not decimal");
+    std::size_t decimals;
+    auto const number = csv::classify(text, decimals);
+    if ((number != csv::Number::integer && number != csv::Number::fixed) || decimals > static_cast<std::size_t>(c.scale))
+        throw std::runtime_error("Error: '" + std::string(text) + "' is not a decimal of scale " + std::to_string(c.scale));
+
+    auto digits = std::string(text);
+    digits.append(static_cast<std::size_t>(c.scale) - decimals, '0');
+    push_magnitude(next(column, true), Integer::value_type(csv::integer_digits(digits)));
+}
+
+
+
+void EecolWriter::push_operand(std::size_t column, Token::pointer_type const& value) {
+    auto const& c = columns_m.at(column);
+    auto const integer = std::dynamic_pointer_cast<Integer>(value);
+    auto const real = std::dynamic_pointer_cast<Real>(value);
+    auto const boolean = std::dynamic_pointer_cast<Boolean>(value);
+
+    switch (c.type) {
+    case EecolType::boolean:
+        if (boolean)
+            return push_boolean(column, boolean->value());
+        break;
+    case EecolType::int64:
+        if (integer && integer->value() >= std::numeric_limits<std::int64_t>::min() && integer->value() <= std::numeric_limits<std::int64_t>::max())
+            return push_int64(column, integer->value().convert_to<std::int64_t>());
+        break;
+    case EecolType::bignum:
+        if (integer)
+            return push_bignum(column, integer->value());
+        break;
+    case EecolType::float64:
+        if (integer)
+            return push_float64(column, integer->value().convert_to<double>());
+        if (real)
+            return push_float64(column, real->value().convert_to<double>());
+        if (boolean)
+            return push_float64(column, boolean->value() ? 1.0 : 0.0);
+        break;
+    case EecolType::decimal:
+        if (integer)
+            return push_decimal(column, Real::value_type(integer->value()));
+        if (real)
+            return push_decimal(column, real->value());
+        break;
+    }
+    throw std::runtime_error("Error: " + (value ? value->str() : std::string("null")) + " does not fit a " + to_string(c.type) + " column");
+}
+
+
+
+void EecolWriter::write(std::FILE* file) const {
+    std::size_t const rows = columns_m.empty() ? 0 : columns_m.front().rows;
+    for (auto const& c : columns_m)
+        if (c.rows != rows)
+            throw std::runtime_error("Error: EECOL column '" + c.name + "' has " + std::to_string(c.rows) + " rows, expected " + std::to_string(rows));
+
+    struct Block { void const* data; std::size_t size; std::size_t offset; };
+    std::vector<Block> blocks;
+    std::vector<unsigned char> head(align(header_size + entry_size * columns_m.size()));
+    std::string names;
+    for (auto const& c : columns_m)
+        names += c.name;
+    std::size_t offset = head.size();
+    auto const nameStart = offset;
+    offset = align(offset + names.size());
+
+    auto const add = [&](void const* data, std::size_t size) -> std::uint64_t {
+        if (size == 0)
+            return 0;
+        blocks.push_back(Block{ data, size, offset });
+        auto const at = offset;
+        offset = align(offset + size);
+        return at;
+    };
+
+    std::vector<std::vector<std::uint8_t>> bitmaps;    // padded copies, so each bitmap covers every row
+    bitmaps.reserve(columns_m.size() * 2);
+    auto const bitmap = [&](std::vector<std::uint8_t> const& bits) {
+        bitmaps.push_back(bits);
+        bitmaps.back().resize(bitmap_size(rows));
+        return add(bitmaps.back().data(), bitmaps.back().size());
+    };
+
+    std::size_t nameOffset = nameStart;
+    for (std::size_t i = 0; i < columns_m.size(); ++i) {
+        auto const& c = columns_m[i];
+        auto* entry = head.data() + header_size + entry_size * i;
+        put<std::uint64_t>(entry + 0, nameOffset);
+        put<std::uint32_t>(entry + 8, static_cast<std::uint32_t>(c.name.size()));
+        entry[12] = static_cast<unsigned char>(c.type);
+        put<std::int16_t>(entry + 14, static_cast<std::int16_t>(c.scale));
+        nameOffset += c.name.size();
+
+        put<std::uint64_t>(entry + 16, c.hasNull ? bitmap(c.validity) : 0);
+        switch (c.type) {
+        case EecolType::boolean:
+            put<std::uint64_t>(entry + 24, bitmap(c.bits));
+            put<std::uint64_t>(entry + 32, bitmap_size(rows));
+            break;
+        case EecolType::int64:
+            put<std::uint64_t>(entry + 24, add(c.int64s.data(), c.int64s.size() * sizeof(std::int64_t)));
+            put<std::uint64_t>(entry + 32, c.int64s.size() * sizeof(std::int64_t));
+            break;
+        case EecolType::float64:
+            put<std::uint64_t>(entry + 24, add(c.doubles.data(), c.doubles.size() * sizeof(double)));
+            put<std::uint64_t>(entry + 32, c.doubles.size() * sizeof(double));
+            break;
+        case EecolType::bignum:
+        case EecolType::decimal:
+            put<std::uint64_t>(entry + 24, add(c.limbs.data(), c.limbs.size() * sizeof(std::uint64_t)));
+            put<std::uint64_t>(entry + 32, c.limbs.size() * sizeof(std::uint64_t));
+            put<std::uint64_t>(entry + 40, add(c.index.data(), c.index.size() * sizeof(std::uint64_t)));
+            put<std::uint64_t>(entry + 48, bitmap(c.bits));
+            break;
+        }
+    }
+
+    std::memcpy(head.data(), magic, sizeof magic);
+    put<std::uint32_t>(head.data() + 8, version);
+    put<std::uint32_t>(head.data() + 12, static_cast<std::uint32_t>(columns_m.size()));
+    put<std::uint64_t>(head.data() + 16, rows);
+    put<std::uint64_t>(head.data() + 24, header_size);
+    put<std::uint64_t>(head.data() + 32, offset);
+
+    BufferedWriter writer(file);
+    std::size_t written = 0;
+    auto const emit = [&](void const* data, std::size_t size, std::size_t at) {
+        writer.write(std::string(at - written, '\0'));
+        writer.write(std::string_view(static_cast<char const*>(data), size));
+        written = at + size;
+    };
+    emit(head.data(), head.size(), 0);
+    emit(names.data(), names.size(), nameStart);
+    for (auto const& block : blocks)
+        emit(block.data, block.size, block.offset);
+    writer.write(std::string(offset - written, '\0'));
+    writer.flush();
+    if (writer.failed())
+        throw std::runtime_error("Error: cannot write the EECOL file");
+}
+
+
+
+// ==================== EecolReader ====================
+
+bool EecolReader::is_eecol(std::string_view bytes) {
+    return bytes.size() >= sizeof magic && std::memcmp(bytes.data(), magic, sizeof magic) == 0;
+}
+
+
+
+EecolReader::EecolReader(std::string_view bytes) : bytes_m(bytes) {
+    auto const fail = [](char const* what) { throw std::runtime_error(std::string("Error: not a valid EECOL file (") + what + ")"); };
+    if (bytes.size() < header_size || !is_eecol(bytes))
+        fail("bad magic");
+    if (get<std::uint32_t>(bytes.data() + 8) != version)
+        fail("unsupported version");
+    auto const count = get<std::uint32_t>(bytes.data() + 12);
+    auto const rows = get<std::uint64_t>(bytes.data() + 16);
+    auto const directory = get<std::uint64_t>(bytes.data() + 24);
+    if (get<std::uint64_t>(bytes.data() + 32) > bytes.size())
+        fail("truncated");
+    if (directory < header_size || directory > bytes.size() || (bytes.size() - directory) / entry_size < count)
+        fail("directory out of range");
+    rows_m = static_cast<std::size_t>(rows);
+
+    auto const inside = [&](std::uint64_t offset, std::uint64_t size) {
+        return offset <= bytes.size() && size <= bytes.size() - offset;
+    };
+    auto const at = [&](std::uint64_t offset) { return reinterpret_cast<std::uint8_t const*>(bytes.data() + offset); };
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        char const* entry = bytes.data() + directory + entry_size * i;
+        Column c;
+        auto const nameOffset = get<std::uint64_t>(entry + 0);
+        auto const nameSize = get<std::uint32_t>(entry + 8);
+        if (!inside(nameOffset, nameSize))
+            fail("name out of range");
+        c.name = bytes.substr(static_cast<std::size_t>(nameOffset), nameSize);
+        c.type = static_cast<EecolType>(static_cast<std::uint8_t>(entry[12]));
+        c.scale = get<std::int16_t>(entry + 14);
+
+        auto const validity = get<std::uint64_t>(entry + 16);
+        auto const data = get<std::uint64_t>(entry + 24);
+        auto const size = get<std::uint64_t>(entry + 32);
+        if (validity != 0) {
+            if (!inside(validity, bitmap_size(rows_m)))
+                fail("validity out of range");
+            c.validity = at(validity);
+        }
+        if (!inside(data, size))
+            fail("data out of range");
+        c.data = at(data);
+
+        switch (c.type) {
+        case EecolType::boolean:
+            if (size < bitmap_size(rows_m))
+                fail("boolean data too short");
+            break;
+        case EecolType::int64:
+        case EecolType::float64:
+            if (size % 8 != 0 || size / 8 != rows || data % 8 != 0)
+                fail("fixed-width data has the wrong size");
+            break;
+        case EecolType::bignum:
+        case EecolType::decimal: {
+            auto const index = get<std::uint64_t>(entry + 40);
+            auto const signs = get<std::uint64_t>(entry + 48);
+            if (rows > (bytes.size() / 8) || !inside(index, (rows + 1) * 8) || index % 8 != 0 || !inside(signs, bitmap_size(rows_m)))
+                fail("index out of range");
+            c.index = reinterpret_cast<std::uint64_t const*>(at(index));
+            c.signs = at(signs);
+            if (c.index[0] != 0 || c.index[rows_m] > size / 8 || !std::is_sorted(c.index, c.index + rows_m + 1))
+                fail("bad limb index");
+            if (c.type == EecolType::decimal && (c.scale < 0 || c.scale > 1000))
+                fail("bad decimal scale");
+            break;
+        }
+        default:
+            fail("unknown column type");
+        }
+        columns_m.push_back(c);
+    }
+}
+
+
+
+std::size_t EecolReader::find(std::string_view name) const {
+    auto const found = std::find_if(columns_m.begin(), columns_m.end(), [&](Column const& c) { return c.name == name; });
+    return static_cast<std::size_t>(found - columns_m.begin());
+}
+
+
+
+bool EecolReader::valid(std::size_t column, std::size_t row) const {
+    auto const& c = columns_m.at(column);
+    return !c.validity || get_bit(c.validity, row);
+}
+
+
+
+bool EecolReader::boolean(std::size_t column, std::size_t row) const {
+    return get_bit(columns_m.at(column).data, row);
+}
+
+
+
+std::span<std::int64_t const> EecolReader::int64s(std::size_t column) const {
+    auto const& c = columns_m.at(column);
+    if (c.type != EecolType::int64)
+        throw std::runtime_error("Error: EECOL column '" + std::string(c.name) + "' is not int64");
+    return { reinterpret_cast<std::int64_t const*>(c.data), rows_m };
+}
+
+
+
+std::span<double const> EecolReader::float64s(std::size_t column) const {
+    auto const& c = columns_m.at(column);
+    if (c.type != EecolType::float64)
+        throw std::runtime_error("Error: EECOL column '" + std::string(c.name) + "' is not float64");
+    return { reinterpret_cast<double const*>(c.data), rows_m };
+}
+
+
+
+Integer::value_type EecolReader::magnitude(Column const& c, std::size_t row) const {
+    Integer::value_type value;
+    auto const* limbs = reinterpret_cast<std::uint64_t const*>(c.data);
+    if (c.index[row + 1] > c.index[row])
+        import_bits(value, limbs + c.index[row], limbs + c.index[row + 1], 64, false);
+    return get_bit(c.signs, row) ? Integer::value_type(-value) : value;
+}
+
+
+
+Integer::value_type EecolReader::bignum(std::size_t column, std::size_t row) const {
+    auto const& c = columns_m.at(column);
+    if (c.type != EecolType::bignum)
+        throw std::runtime_error("Error: EECOL column '" + std::string(c.name) + "' is not bignum");
+    return magnitude(c, row);
+}
+
+
+
+Real::value_type EecolReader::decimal(std::size_t column, std::size_t row) const {
+    auto const& c = columns_m.at(column);
+    if (c.type != EecolType::decimal)
+        throw std::runtime_error("Error: EECOL column '" + std::string(c.name) + "' is not decimal");
+    // parsing the exact digits is cheaper than a 1000-digit division by 10^scale
+    return Real::value_type(decimal_text(c, row));
+}
+
+
+
+Operand::pointer_type EecolReader::operand(std::size_t column, std::size_t row) const {
+    if (!valid(column, row))
+        return nullptr;
+    auto const& c = columns_m[column];
+    switch (c.type) {
+    case EecolType::boolean:    return std::make_shared<Boolean>(boolean(column, row));
+    case EecolType::int64:      return std::make_shared<Integer>(Integer::value_type(int64s(column)[row]));
+    case EecolType::bignum:     return std::make_shared<Integer>(bignum(column, row));
+    case EecolType::float64:    return std::make_shared<Real>(Real::value_type(float64s(column)[row]));
+    case EecolType::decimal:    return std::make_shared<Real>(decimal(column, row));
+    }
+    return nullptr;
+}
+
+
+
+std::string EecolReader::decimal_text(Column const& c, std::size_t row) const {
+    auto const value = magnitude(c, row);
+    auto digits = Integer::value_type(boost::multiprecision::abs(value)).str();
+    auto const scale = static_cast<std::size_t>(c.scale);
+    if (scale > 0) {
+        if (digits.size() <= scale)
+            digits.insert(0, scale + 1 - digits.size(), '0');
+        digits.insert(digits.size() - scale, 1, '.');
+    }
+    return value < 0 ? "-" + digits : digits;
+}
+
+
+
+std::string EecolReader::text(std::size_t column, std::size_t row) const {
+    if (!valid(column, row))
+        return {};
+    auto const& c = columns_m[column];
+    switch (c.type) {
+    case EecolType::boolean:
+        return boolean(column, row) ? "true" : "false";
+    case EecolType::int64:
+        return std::to_string(int64s(column)[row]);
+    case EecolType::bignum:
+        return bignum(column, row).str();
+    case EecolType::float64: {
+        char buffer[32];
+        auto const [end, ec] = std::to_chars(buffer, buffer + sizeof buffer, float64s(column)[row]);
+        return std::string(buffer, end);
+    }
+    case EecolType::decimal:
+        return decimal_text(c, row);
+    }
+    return {};
+}
+
+
+
+// ==================== CSV conversion ====================
+
+std::vector<std::string> csv_to_eecol(std::string_view text, std::FILE* output) {
+    std::vector<std::string_view> names, fields;
+    std::size_t headerLine;
+    auto const data = csv::split_header(text, names, headerLine);
+
+    // find the narrowest type of each column
+    struct Kind {
+        bool boolean = true, integer = true, int64 = true, fixed = true, numeric = true;
+        std::size_t decimals = 0;
+    };
+    std::vector<Kind> kinds(names.size());
+    auto const is_boolean = [](std::string_view field) {
+        auto const lower = [](std::string_view f, char const* word) {
+            return f.size() == std::strlen(word) && std::equal(f.begin(), f.end(), word, [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; });
+        };
+        return lower(field, "true") || lower(field, "false");
+    };
+    for_each_line(data, [&](std::string_view line) {
+        if (csv::trim(line).empty())
+            return;
+        csv::split_fields(line, fields);
+        for (std::size_t i = 0; i < names.size() && i < fields.size(); ++i) {
+            auto const field = fields[i];
+            if (field.empty())
+                continue;
+            auto& k = kinds[i];
+            k.boolean = k.boolean && is_boolean(field);
+            std::size_t decimals;
+            auto const number = csv::classify(field, decimals);
+            k.numeric = k.numeric && number != csv::Number::none;
+            k.integer = k.integer && number == csv::Number::integer;
+            k.fixed = k.fixed && (number == csv::Number::integer || number == csv::Number::fixed);
+            k.decimals = std::max(k.decimals, decimals);
+            if (k.int64 && number == csv::Number::integer) {
+                std::int64_t value;
+                auto const digits = field.front() == '+' ? field.substr(1) : field;
+                auto const [end, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+                k.int64 = ec == std::errc() && end == digits.data() + digits.size();
+            }
+        }
+    });
+
+    EecolWriter writer;
+    std::vector<std::size_t> columnOf(names.size(), std::size_t(-1));
+    std::vector<EecolType> types(names.size());
+    std::vector<std::string> skipped;
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        auto const& k = kinds[i];
+        auto& type = types[i];
+        if (k.boolean && !k.integer)
+            type = EecolType::boolean;
+        else if (!k.numeric) {
+            skipped.emplace_back(names[i]);
+            continue;
+        }
+        else if (k.integer)
+            type = k.int64 ? EecolType::int64 : EecolType::bignum;
+        else if (k.fixed && k.decimals <= 1000)
+            type = EecolType::decimal;
+        else
+            type = EecolType::float64;
+        columnOf[i] = writer.add_column(std::string(names[i]), type, static_cast<int>(k.decimals));
+    }
+
+    for_each_line(data, [&](std::string_view line) {
+        if (csv::trim(line).empty())
+            return;
+        csv::split_fields(line, fields);
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            auto const c = columnOf[i];
+            if (c == std::size_t(-1))
+                continue;
+            if (i >= fields.size() || fields[i].empty()) {
+                writer.push_null(c);
+                continue;
+            }
+            auto const field = fields[i];
+            auto const digits = std::string(field.front() == '+' ? field.substr(1) : field);
+            switch (types[i]) {
+            case EecolType::boolean:    writer.push_boolean(c, std::tolower(static_cast<unsigned char>(field.front())) == 't'); break;
+            case EecolType::int64:      writer.push_int64(c, std::strtoll(digits.c_str(), nullptr, 10)); break;
+            case EecolType::bignum:     writer.push_bignum(c, Integer::value_type(csv::integer_digits(field))); break;
+            case EecolType::decimal:    writer.push_decimal(c, std::string_view(field)); break;
+            case EecolType::float64:    writer.push_float64(c, std::strtod(digits.c_str(), nullptr)); break;
+            }
+        }
+    });
+
+    writer.write(output);
+    return skipped;
+}
+
+
+
+void eecol_to_csv(EecolReader const& input, std::FILE* output) {
+    auto const field = [](std::string_view text) {
+        return text.find_first_of(",\" \t") == std::string_view::npos ? std::string(text) : csv::quoted(text);
+    };
+    BufferedWriter writer(output);
+    std::string line;
+    for (std::size_t c = 0; c < input.columns().size(); ++c)
+        line += (c ? "," : "") + field(input.columns()[c].name);
+    writer.write(line + "\n");
+    for (std::size_t r = 0; r < input.rows(); ++r) {
+        line.clear();
+        for (std::size_t c = 0; c < input.columns().size(); ++c) {
+            if (c)
+                line += ',';
+            line += input.text(c, r);
+        }
+        line += '\n';
+        writer.write(line);
+    }
+    writer.flush();
+    if (writer.failed())
+        throw std::runtime_error("Error: cannot write the CSV file");
+}
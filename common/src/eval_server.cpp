@@ -0,0 +1,636 @@
+/*! \file eval_server.cpp
+    \brief EvalServer class implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+    Cheap and expensive lanes, shortest estimated job first.
+    Evaluation limits; a session's work is cancelled when it closes.
+
+============================================================= */
+
+#include <ee/eval_server.hpp>
+#include <ee/cost_estimator.hpp>
+#include <ee/expression_evaluator.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <optional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+
+
+#if defined(__linux__)
+
+namespace {
+    constexpr std::size_t batch_size = 64;              // requests a worker takes from a session at a time
+    constexpr std::size_t max_pending = 4096;           // unanswered requests before reading pauses
+    constexpr std::size_t max_unsent = 4 << 20;         // unsent reply bytes before reading pauses
+    constexpr std::size_t read_size = 64 << 10;
+    constexpr std::size_t latency_samples = 8192;       // recent requests kept per lane for percentiles
+
+    using Clock = std::chrono::steady_clock;
+
+    [[noreturn]] void fail(std::string const& what) {
+        throw std::runtime_error("Error: " + what + ": " + std::strerror(errno));
+    }
+
+    [[nodiscard]] bool is_blank(std::string_view line) {
+        return std::all_of(line.begin(), line.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; });
+    }
+
+    struct Request {
+        std::string         text;       // empty for an over-long line
+        Clock::time_point   arrived;
+    };
+
+    /*! Per-connection state.  Owned by the event loop; a worker holds it while 'scheduled'. */
+    struct Session {
+        int fd;
+
+        // worker side: touched by one worker at a time, chosen through 'scheduled'
+        ExpressionEvaluator                 evaluator;
+        std::vector<Token::pointer_type>    results;
+        bool            classified = false;     // the first pending request is compiled and costed
+        TokenList       rpn;
+        std::string     error;
+        double          cost = 0;
+
+        // shared, under 'mutex'
+        std::mutex                  mutex;
+        std::deque<Request>         pending;
+        std::string                 replies;
+        bool                        scheduled = false;
+
+        // event loop only
+        std::string     input;
+        std::string     sending;
+        std::size_t     sent = 0;
+        bool            readable = true;    // EPOLLIN registered
+        bool            writable = false;   // EPOLLOUT registered
+        bool            endOfInput = false;
+        bool            closed = false;
+
+        explicit Session(int fd) : fd(fd) {}
+
+        /*! Compiles the request 'text' and estimates its cost.  History lookups and errors cost nothing. */
+        void classify(std::string const& text, CostEstimator const& estimator) {
+            classified = true;
+            rpn.clear();
+            error.clear();
+            cost = 0;
+            if (text.empty() || (text.front() == '[' && text.back() == ']') || text.front() == '#')
+                return;
+            try {
+                rpn = evaluator.compile(text);
+                cost = estimator.estimate(rpn).microseconds;
+            }
+            catch (std::exception const& ex) {
+                error = ex.what();
+            }
+            catch (...) {
+                error = "unknown error";
+            }
+        }
+
+        /*! Evaluates the classified request 'text', returning its reply line. */
+        [[nodiscard]] std::string answer(std::string_view text) {
+            classified = false;
+            if (text.empty())
+                return "Error: line longer than " + std::to_string(EvalServer::max_line_size) + " bytes\n";
+            if (text.size() > 2 && text.front() == '[' && text.back() == ']') {
+                std::size_t n = 0;
+                auto const [end, ec] = std::from_chars(text.data() + 1, text.data() + text.size() - 1, n);
+                if (ec == std::errc() && end == text.data() + text.size() - 1) {
+                    if (n == 0 || n > results.size())
+                        return "Error: no result [" + std::to_string(n) + "]\n";
+                    return "[" + std::to_string(n) + "] = " + results[n - 1]->str() + "\n";
+                }
+            }
+            try {
+                if (!error.empty())
+                    throw std::runtime_error(error);
+                auto result = rpn.empty() ? evaluator.evaluate(text) : evaluator.run(rpn);
+                results.push_back(result);
+                return "[" + std::to_string(results.size()) + "] = " + result->str() + "\n";
+            }
+            catch (std::exception const& ex) {
+                std::string_view const what = ex.what();
+                return (what.starts_with("Error") ? std::string(what) : "Error: " + std::string(what)) + "\n";
+            }
+            catch (...) {
+                return "Error: unknown error\n";
+            }
+        }
+    };
+
+    using session_pointer = std::shared_ptr<Session>;
+}
+
+
+
+struct EvalServer::Impl {
+    /*! A worker pool with its own queue: sessions ordered by arrival time plus estimated cost. */
+    struct Lane {
+        unsigned                                workers = 1;
+        std::multimap<double, session_pointer>  ready;
+        std::condition_variable                 changed;
+
+        // under statsMutex
+        std::size_t         requests = 0;
+        double              slowest = 0;
+        std::vector<double> recent;         // ring buffer of latencies in microseconds
+    };
+
+    std::string     path;
+    int             listener = -1;
+    int             epoll = -1;
+    int             wake = -1;              // eventfd: finished work or stop()
+    std::atomic<bool>           stopping{ false };
+    std::atomic<std::size_t>    connections{ 0 };
+    std::atomic<std::size_t>    requests{ 0 };
+    Clock::time_point const     started = Clock::now();
+    CostEstimator               estimator;
+    double                      expensiveMicroseconds = EvalServer::default_expensive_microseconds;
+    EvaluationBudget::Limits    limits = EvalServer::default_limits();
+
+    std::unordered_map<int, session_pointer> sessions;     // event loop only
+
+    std::mutex                  queueMutex;
+    std::array<Lane, 2>         lanes;
+    std::vector<session_pointer> finished;  // sessions with new replies, for the event loop
+    bool                        quit = false;
+    mutable std::mutex          statsMutex;
+
+    explicit Impl(std::string const& path) : path(path) {}
+
+    ~Impl() {
+        for (int fd : { listener, epoll, wake })
+            if (fd >= 0)
+                ::close(fd);
+    }
+
+    [[nodiscard]] double microseconds_since(Clock::time_point from, Clock::time_point to = Clock::now()) const {
+        return std::chrono::duration<double, std::micro>(to - from).count();
+    }
+
+    /*! Queues 'session', whose next request is expected to take 'cost' microseconds.  Call under queueMutex. */
+    void enqueue(session_pointer session, double cost) {
+        auto& lane = lanes[cost > expensiveMicroseconds ? 1 : 0];
+        lane.ready.emplace(microseconds_since(started) + cost, std::move(session));
+        lane.changed.notify_one();
+    }
+
+    void record(Lane& lane, std::vector<double> const& latencies) {
+        std::lock_guard lock(statsMutex);
+        for (double latency : latencies) {
+            if (lane.recent.size() < latency_samples)
+                lane.recent.push_back(latency);
+            else
+                lane.recent[lane.requests % latency_samples] = latency;
+            ++lane.requests;
+            lane.slowest = std::max(lane.slowest, latency);
+        }
+    }
+
+    [[nodiscard]] EvalServer::LaneStats stats(EvalServer::Lane which) const {
+        auto const& lane = lanes[static_cast<std::size_t>(which)];
+        EvalServer::LaneStats result;
+        std::vector<double> recent;
+        {
+            std::lock_guard lock(statsMutex);
+            result.workers = lane.workers;
+            result.requests = lane.requests;
+            result.max = lane.slowest;
+            recent = lane.recent;
+        }
+        if (recent.empty())
+            return result;
+        auto const percentile = [&](double p) {
+            auto const at = recent.begin() + static_cast<std::ptrdiff_t>(p * static_cast<double>(recent.size() - 1));
+            std::nth_element(recent.begin(), at, recent.end());
+            return *at;
+        };
+        result.p50 = percentile(0.50);
+        result.p90 = percentile(0.90);
+        result.p99 = percentile(0.99);
+        return result;
+    }
+
+    [[nodiscard]] std::string stats_line() const {
+        std::string line = "#";
+        for (auto which : { EvalServer::Lane::cheap, EvalServer::Lane::expensive }) {
+            auto const lane = stats(which);
+            auto const us = [](double x) { return std::to_string(static_cast<long long>(x)) + " us"; };
+            line += (which == EvalServer::Lane::cheap ? " cheap: " : "; expensive: ") + std::to_string(lane.requests)
+                + " requests, p50 " + us(lane.p50) + ", p90 " + us(lane.p90) + ", p99 " + us(lane.p99) + ", max " + us(lane.max);
+        }
+        return line + "\n";
+    }
+
+    void watch(Session& s) {
+        epoll_event event{};
+        event.events = (s.readable ? EPOLLIN : 0u) | (s.writable ? EPOLLOUT : 0u);
+        event.data.fd = s.fd;
+        epoll_ctl(epoll, EPOLL_CTL_MOD, s.fd, &event);
+    }
+
+    /*! Takes the session with the smallest key from the lane and answers its requests in order
+        until it has none, has had its turn, or the next one belongs in the other lane.  A turn
+        in the expensive lane is one request, so its reply goes out at once. */
+    void worker(std::size_t laneNumber) {
+        auto& lane = lanes[laneNumber];
+        std::size_t const turn = laneNumber == 0 ? batch_size : 1;
+        for (;;) {
+            session_pointer s;
+            {
+                std::unique_lock lock(queueMutex);
+                lane.changed.wait(lock, [&] { return quit || !lane.ready.empty(); });
+                if (quit)
+                    return;
+                s = std::move(lane.ready.begin()->second);
+                lane.ready.erase(lane.ready.begin());
+            }
+
+            std::vector<double> latencies;
+            std::optional<double> requeue;
+            for (;;) {
+                Request request;
+                {
+                    std::lock_guard lock(s->mutex);
+                    if (s->pending.empty()) {
+                        s->scheduled = false;
+                        break;
+                    }
+                    request = s->pending.front();
+                }
+                if (!s->classified)
+                    s->classify(request.text, estimator);
+                if (latencies.size() == turn || (s->cost > expensiveMicroseconds) != (laneNumber == 1)) {
+                    requeue = s->cost;
+                    break;
+                }
+
+                std::string reply;
+                if (request.text == "#stats") {
+                    s->classified = false;
+                    reply = stats_line();
+                }
+                else
+                    reply = s->answer(request.text);
+                latencies.push_back(microseconds_since(request.arrived));
+                std::lock_guard lock(s->mutex);
+                s->pending.pop_front();
+                s->replies += reply;
+            }
+            requests += latencies.size();
+            record(lane, latencies);
+
+            {
+                std::lock_guard lock(queueMutex);
+                if (requeue)
+                    enqueue(s, *requeue);
+                if (latencies.empty())
+                    continue;
+                finished.push_back(std::move(s));
+            }
+            std::uint64_t const one = 1;
+            [[maybe_unused]] auto const written = ::write(wake, &one, sizeof one);
+        }
+    }
+
+    void accept_all() {
+        for (;;) {
+            int const fd = ::accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0)
+                return;     // EAGAIN, or a connection that failed before it was accepted
+            auto s = std::make_shared<Session>(fd);
+            s->evaluator.rpn_evaluator().budget().set_limits(limits);
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+            if (epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event) != 0) {
+                ::close(fd);
+                continue;
+            }
+            sessions.emplace(fd, std::move(s));
+            ++connections;
+        }
+    }
+
+    void close_session(Session& s) {
+        s.closed = true;
+        s.evaluator.rpn_evaluator().budget().cancel();     // nobody is left to read the answer
+        epoll_ctl(epoll, EPOLL_CTL_DEL, s.fd, nullptr);
+        ::close(s.fd);
+        sessions.erase(s.fd);       // a worker may still hold it; its replies are dropped
+    }
+
+    /*! Splits complete lines from the input into requests and schedules the session. */
+    void take_requests(session_pointer const& s) {
+        std::vector<std::string> lines;
+        auto const take = [&](std::string_view line) {
+            if (!line.empty() && line.back() == '\r')
+                line.remove_suffix(1);
+            if (!is_blank(line))
+                lines.emplace_back(line);
+        };
+        std::size_t start = 0;
+        for (std::size_t end; (end = s->input.find('\n', start)) != std::string::npos; start = end + 1)
+            take(std::string_view(s->input).substr(start, end - start));
+        s->input.erase(0, start);
+        if (s->input.size() > EvalServer::max_line_size) {
+            lines.emplace_back();       // answered as an over-long line; nothing after it is read
+            s->input.clear();
+            s->endOfInput = true;
+        }
+        else if (s->endOfInput) {
+            take(s->input);             // a last line without a newline
+            s->input.clear();
+        }
+        if (lines.empty())
+            return;
+
+        bool schedule;
+        auto const now = Clock::now();
+        {
+            std::lock_guard lock(s->mutex);
+            for (auto& line : lines)
+                s->pending.push_back(Request{ std::move(line), now });
+            schedule = !s->scheduled;
+            s->scheduled = true;
+        }
+        if (schedule) {
+            std::lock_guard lock(queueMutex);
+            enqueue(s, 0);      // not costed yet; the worker moves it if it is expensive
+        }
+    }
+
+    /*! Reads until the socket would block, or enough for one over-long line (epoll reports the rest). */
+    void read_from(session_pointer const& s) {
+        char buffer[read_size];
+        while (s->input.size() <= EvalServer::max_line_size) {
+            auto const n = ::read(s->fd, buffer, sizeof buffer);
+            if (n > 0)
+                s->input.append(buffer, static_cast<std::size_t>(n));
+            else if (n == 0) {
+                s->endOfInput = true;
+                break;
+            }
+            else if (errno == EAGAIN)
+                break;
+            else if (errno != EINTR) {
+                close_session(*s);
+                return;
+            }
+        }
+        take_requests(s);
+        if (s->endOfInput) {
+            s->readable = false;
+            watch(*s);
+        }
+    }
+
+    /*! Sends what it can, then decides whether to read, wait for writability or close. */
+    void flush(session_pointer const& s) {
+        std::size_t pending;
+        bool busy;
+        {
+            std::lock_guard lock(s->mutex);
+            if (!s->replies.empty()) {
+                if (s->sent == s->sending.size()) {
+                    s->sending.swap(s->replies);
+                    s->replies.clear();
+                    s->sent = 0;
+                }
+                else if (s->sending.size() - s->sent < max_unsent) {
+                    s->sending += s->replies;
+                    s->replies.clear();
+                }
+            }
+            pending = s->pending.size();
+            busy = s->scheduled;
+        }
+
+        while (s->sent < s->sending.size()) {
+            auto const n = ::send(s->fd, s->sending.data() + s->sent, s->sending.size() - s->sent, MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EINTR)
+                    continue;
+                if (errno == EAGAIN)
+                    break;
+                close_session(*s);
+                return;
+            }
+            s->sent += static_cast<std::size_t>(n);
+        }
+        if (s->sent == s->sending.size()) {
+            s->sending.clear();
+            s->sent = 0;
+        }
+
+        auto const unsent = s->sending.size() - s->sent;
+        if (s->endOfInput && !busy && pending == 0 && unsent == 0) {
+            std::lock_guard lock(s->mutex);
+            if (s->replies.empty()) {
+                close_session(*s);
+                return;
+            }
+        }
+        bool const readable = !s->endOfInput && pending < max_pending && unsent < max_unsent;
+        bool const writable = unsent > 0;
+        if (readable != s->readable || writable != s->writable) {
+            s->readable = readable;
+            s->writable = writable;
+            watch(*s);
+        }
+    }
+};
+
+
+
+EvalServer::EvalServer(std::string const& path, unsigned workers) : impl_m(std::make_unique<Impl>(path)) {
+    if (workers == 0)
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    impl_m->lanes[1].workers = std::max(1u, workers / 4);
+    impl_m->lanes[0].workers = std::max(1u, workers - impl_m->lanes[1].workers);
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof address.sun_path)
+        throw std::runtime_error("Error: bad socket path '" + path + "'");
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    struct stat info;
+    if (::lstat(path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode))
+        ::unlink(path.c_str());
+
+    impl_m->listener = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (impl_m->listener < 0)
+        fail("cannot create a socket");
+    if (::bind(impl_m->listener, reinterpret_cast<sockaddr const*>(&address), sizeof address) != 0)
+        fail("cannot bind " + path);
+    if (::listen(impl_m->listener, SOMAXCONN) != 0)
+        fail("cannot listen on " + path);
+
+    impl_m->epoll = ::epoll_create1(EPOLL_CLOEXEC);
+    impl_m->wake = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (impl_m->epoll < 0 || impl_m->wake < 0)
+        fail("cannot create the event loop");
+    for (int fd : { impl_m->listener, impl_m->wake }) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(impl_m->epoll, EPOLL_CTL_ADD, fd, &event) != 0)
+            fail("cannot create the event loop");
+    }
+}
+
+
+
+EvalServer::~EvalServer() = default;
+
+
+
+void EvalServer::run() {
+    auto& impl = *impl_m;
+    impl.quit = false;
+    std::vector<std::thread> workers;
+    for (std::size_t lane = 0; lane < impl.lanes.size(); ++lane)
+        for (unsigned i = 0; i < impl.lanes[lane].workers; ++i)
+            workers.emplace_back([&impl, lane] { impl.worker(lane); });
+
+    epoll_event events[64];
+    while (!impl.stopping) {
+        int const n = epoll_wait(impl.epoll, events, 64, -1);
+        if (n < 0 && errno != EINTR)
+            break;
+        for (int i = 0; i < n; ++i) {
+            int const fd = events[i].data.fd;
+            if (fd == impl.listener) {
+                impl.accept_all();
+                continue;
+            }
+            if (fd == impl.wake) {
+                std::uint64_t count;
+                [[maybe_unused]] auto const got = ::read(impl.wake, &count, sizeof count);
+                std::vector<session_pointer> finished;
+                {
+                    std::lock_guard lock(impl.queueMutex);
+                    finished.swap(impl.finished);
+                }
+                for (auto const& s : finished)
+                    if (!s->closed)
+                        impl.flush(s);
+                continue;
+            }
+
+            auto const found = impl.sessions.find(fd);
+            if (found == impl.sessions.end())
+                continue;
+            auto const s = found->second;
+            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                impl.close_session(*s);     // the client has gone and cannot take replies
+                continue;
+            }
+            if (events[i].events & EPOLLIN)
+                impl.read_from(s);
+            if (!s->closed)
+                impl.flush(s);
+        }
+    }
+
+    for (auto const& [fd, s] : impl.sessions)
+        s->evaluator.rpn_evaluator().budget().cancel();
+    {
+        std::lock_guard lock(impl.queueMutex);
+        impl.quit = true;
+        for (auto& lane : impl.lanes) {
+            lane.ready.clear();
+            lane.changed.notify_all();
+        }
+        impl.finished.clear();
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    while (!impl.sessions.empty())
+        impl.close_session(*impl.sessions.begin()->second);
+    ::close(impl.listener);
+    impl.listener = -1;
+    ::unlink(impl.path.c_str());
+}
+
+
+
+void EvalServer::stop() {
+    impl_m->stopping = true;
+    std::uint64_t const one = 1;
+    [[maybe_unused]] auto const written = ::write(impl_m->wake, &one, sizeof one);
+}
+
+
+
+void EvalServer::set_lanes(unsigned cheapWorkers, unsigned expensiveWorkers, double expensiveMicroseconds) {
+    impl_m->lanes[0].workers = std::max(1u, cheapWorkers);
+    impl_m->lanes[1].workers = std::max(1u, expensiveWorkers);
+    impl_m->expensiveMicroseconds = expensiveMicroseconds;
+}
+
+
+
+void EvalServer::set_limits(EvaluationBudget::Limits const& limits) { impl_m->limits = limits; }
+EvaluationBudget::Limits EvalServer::limits() const { return impl_m->limits; }
+unsigned EvalServer::workers() const { return impl_m->lanes[0].workers + impl_m->lanes[1].workers; }
+std::size_t EvalServer::connections() const { return impl_m->connections; }
+std::size_t EvalServer::requests() const { return impl_m->requests; }
+EvalServer::LaneStats EvalServer::lane_stats(Lane lane) const { return impl_m->stats(lane); }
+
+#else
+
+struct EvalServer::Impl {};
+
+EvalServer::EvalServer(std::string const&, unsigned) {
+    throw std::runtime_error("Error: the evaluation server needs Linux (epoll)");
+}
+
+EvalServer::~EvalServer() = default;
+void EvalServer::run() {}
+void EvalServer::stop() {}
+void EvalServer::set_lanes(unsigned, unsigned, double) {}
+void EvalServer::set_limits(EvaluationBudget::Limits const&) {}
+EvaluationBudget::Limits EvalServer::limits() const { return {}; }
+unsigned EvalServer::workers() const { return 0; }
+std::size_t EvalServer::connections() const { return 0; }
+std::size_t EvalServer::requests() const { return 0; }
+EvalServer::LaneStats EvalServer::lane_stats(Lane) const { return {}; }
+
+#endif
@@ -0,0 +1,40 @@
+/*! \file evaluation_budget.cpp
+    \brief EvaluationBudget class implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/evaluation_budget.hpp>
+
+
+
+void EvaluationBudget::check() const {
+    if (cancelled())
+        fail(BudgetExceeded::Limit::cancelled);
+    if (limits_m.time.count() != 0 && clock::now() > deadline_m)
+        fail(BudgetExceeded::Limit::time);
+}
+
+
+
+void EvaluationBudget::fail(BudgetExceeded::Limit limit) const {
+    switch (limit) {
+    case BudgetExceeded::Limit::time:
+        throw BudgetExceeded(limit, "Error: evaluation exceeded its time limit of " + std::to_string(limits_m.time.count()) + " us");
+    case BudgetExceeded::Limit::bits:
+        throw BudgetExceeded(limit, "Error: result would exceed the integer limit of " + std::to_string(limits_m.bits) + " bits");
+    case BudgetExceeded::Limit::operations:
+        throw BudgetExceeded(limit, "Error: evaluation exceeded its limit of " + std::to_string(limits_m.operations) + " operations");
+    default:
+        throw BudgetExceeded(limit, "Error: evaluation cancelled");
+    }
+}
@@ -0,0 +1,48 @@
+/*! \file evaluator_stats.cpp
+    \brief EvaluatorStats implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/evaluator_stats.hpp>
+#include <iomanip>
+#include <sstream>
+
+
+
+namespace {
+    void write_stage(std::ostream& os, char const* name, EvaluatorStats::Stage const& stage) {
+        auto const average = stage.calls == 0 ? 0.0 : static_cast<double>(stage.nanoseconds) / static_cast<double>(stage.calls);
+        os << std::left << std::setw(10) << name << std::right
+            << std::setw(10) << stage.calls
+            << std::setw(14) << std::fixed << std::setprecision(3) << static_cast<double>(stage.nanoseconds) / 1e6
+            << std::setw(12) << std::setprecision(0) << average
+            << std::setw(12) << stage.lastNanoseconds
+            << std::setw(13) << stage.allocations
+            << std::setw(12) << stage.exceptions << '\n';
+    }
+}
+
+
+
+std::ostream& operator << (std::ostream& os, EvaluatorStats const& stats) {
+    std::ostringstream table;      // leaves the caller's stream formatting alone
+    if (!EvaluatorStats::enabled)
+        table << "(statistics disabled: built with EE_STATS=0)\n";
+    table << "stage          calls      total ms     mean ns     last ns  allocations  exceptions\n";
+    write_stage(table, "lex", stats.lex);
+    write_stage(table, "parse", stats.parse);
+    write_stage(table, "evaluate", stats.evaluate);
+    table << "tokens: " << stats.tokens << " (last " << stats.lastTokens << ")\n"
+        << "operand stack high-water: " << stats.stackHighWater << " (last " << stats.lastStackHighWater << ")\n";
+    return os << table.str();
+}
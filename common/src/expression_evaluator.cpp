@@ -8,6 +8,10 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	evaluate() split into compile() and run().
+	evaluate() and compile() take a std::string_view.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -33,34 +37,37 @@ the program(s) have been supplied.
 #include <ee/RPNEvaluator.hpp>
 #include <ee/operator.hpp>
 #include <ee/function.hpp>
+#include <ee/trace.hpp>
+
+[[nodiscard]] ExpressionEvaluator::result_type ExpressionEvaluator::evaluate(ExpressionEvaluator::expression_type expr) {
+    return run(compile(expr));
+}
 
-#if defined(SHOW_STEPS)
-#include <iostream>
-#endif
 
-[[nodiscard]] ExpressionEvaluator::result_type ExpressionEvaluator::evaluate(ExpressionEvaluator::expression_type const& expr) {
-    TokenList infixTokens = tokenizer_m.tokenize(expr);
 
-#if defined(SHOW_STEPS)
+[[nodiscard]] TokenList ExpressionEvaluator::compile(ExpressionEvaluator::expression_type expr) {
+    TokenList infixTokens;
     {
-        std::cout << "Lexer output:" << std::endl;
-        for (const auto& token : infixTokens)
-            std::cout << token->str() << " ";
-        std::cout << std::endl;
+        EvaluatorStats::Timer timer(stats_m.lex);
+        TraceSpan span("tokenize");
+        infixTokens = tokenizer_m.tokenize(expr);
     }
-#endif
+    stats_m.record_tokens(infixTokens.size());
+
+    EvaluatorStats::Timer timer(stats_m.parse);
+    TraceSpan span("parse");
+    return parser_m.parse(infixTokens);
+}
 
-    TokenList postfixTokens = parser_m.parse(infixTokens);
 
-#if defined(SHOW_STEPS)
+
+[[nodiscard]] ExpressionEvaluator::result_type ExpressionEvaluator::run(TokenList const& rpnExpression) {
+    result_type result;
     {
-        std::cout << "Parser output (RPN):" << std::endl;
-        for (const auto& token : postfixTokens)
-            std::cout << token->str() << " ";
-        std::cout << std::endl;
+        EvaluatorStats::Timer timer(stats_m.evaluate);
+        TraceSpan span("evaluate");
+        result = rpn_m.evaluate(rpnExpression);
     }
-#endif
-
-    Operand::pointer_type result = rpn_m.evaluate(postfixTokens);
+    stats_m.record_stack(rpn_m.stack_high_water());
     return result;
-}
\ No newline at end of file
+}
@@ -11,6 +11,9 @@ Declarations of the Function classes derived from Operation.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Exp, Ln, Lb, Log, Arctan and Arctan2 use the real_kernels implementations.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -47,6 +50,7 @@ the program(s) have been supplied.
 #include <ee/integer.hpp>
 #include <ee/real.hpp>
 #include <ee/expression_evaluator.hpp>
+#include <ee/real_kernels.hpp>
 #include <algorithm>
 #include <cmath>
 #include <boost/multiprecision/cpp_int.hpp>
@@ -146,7 +150,7 @@ Operand::pointer_type Tan::evaluate(std::vector<Operand::pointer_type> const& op
 // Exp function implementation
 Operand::pointer_type Exp::evaluate(std::vector<Operand::pointer_type> const& operands) const {
     auto value = std::dynamic_pointer_cast<Real>(operands[0])->value();
-    return std::make_shared<Real>(boost::multiprecision::exp(value));
+    return std::make_shared<Real>(real_kernels::exp(value));
 }
 
 // Sqrt function implementation
@@ -158,7 +162,7 @@ Operand::pointer_type Sqrt::evaluate(std::vector<Operand::pointer_type> const& o
 // Ln function implementation (natural logarithm)
 Operand::pointer_type Ln::evaluate(std::vector<Operand::pointer_type> const& operands) const {
     auto value = std::dynamic_pointer_cast<Real>(operands[0])->value();
-    return std::make_shared<Real>(boost::multiprecision::log(value));
+    return std::make_shared<Real>(real_kernels::log(value));
 }
 
 // Abs function implementation
@@ -182,7 +186,7 @@ Operand::pointer_type Arcsin::evaluate(std::vector<Operand::pointer_type> const&
 // Arctan function implementation
 Operand::pointer_type Arctan::evaluate(std::vector<Operand::pointer_type> const& operands) const {
     auto value = std::dynamic_pointer_cast<Real>(operands[0])->value();
-    return std::make_shared<Real>(boost::multiprecision::atan(value));
+    return std::make_shared<Real>(real_kernels::atan(value));
 }
 
 // Ceil function implementation
@@ -200,20 +204,20 @@ Operand::pointer_type Floor::evaluate(std::vector<Operand::pointer_type> const&
 // Lb function implementation (log base 2)
 Operand::pointer_type Lb::evaluate(std::vector<Operand::pointer_type> const& operands) const {
     auto value = std::dynamic_pointer_cast<Real>(operands[0])->value();
-    return std::make_shared<Real>(boost::multiprecision::log2(value));
+    return std::make_shared<Real>(real_kernels::log2(value));
 }
 
 // Log function implementation (log base 10)
 Operand::pointer_type Log::evaluate(std::vector<Operand::pointer_type> const& operands) const {
     auto value = std::dynamic_pointer_cast<Real>(operands[0])->value();
-    return std::make_shared<Real>(boost::multiprecision::log10(value));
+    return std::make_shared<Real>(real_kernels::log10(value));
 }
 
 // Arctan2 function implementation
 Operand::pointer_type Arctan2::evaluate(std::vector<Operand::pointer_type> const& operands) const {
     auto y = std::dynamic_pointer_cast<Real>(operands[0])->value();
     auto x = std::dynamic_pointer_cast<Real>(operands[1])->value();
-    return std::make_shared<Real>(boost::multiprecision::atan2(y, x));
+    return std::make_shared<Real>(real_kernels::atan2(y, x));
 }
 
 Operand::pointer_type Result::evaluate(std::vector<Operand::pointer_type> const& operands) const {
@@ -222,13 +226,12 @@ Operand::pointer_type Result::evaluate(std::vector<Operand::pointer_type> const&
         throw std::runtime_error("Error: Result function requires exactly one argument.");
     }
 
-    // Get the index as an integer
+    // The index must be an integer
     auto indexOperand = std::dynamic_pointer_cast<Integer>(operands[0]);
     if (!indexOperand) {
         throw std::runtime_error("Error: Result index must be an integer.");
     }
-    auto index = static_cast<size_t>(indexOperand->value());
 
-    // Retrieve the result by index
+    // Retrieving the result by index needs the ExpressionEvaluator's history
     throw std::runtime_error("Error: Cannot retrieve previous results without access to ExpressionEvaluator.");
 }
\ No newline at end of file
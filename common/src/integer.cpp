@@ -11,6 +11,11 @@ Implementations of the Integer class derived from Operand.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	factorial() and power() honour the current EvaluationBudget.
+	Added factorial_terms(), product() and PowerSteps, for evaluations that pause.
+	str(), factorial() and power() record trace spans.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -51,40 +56,84 @@ the program(s) have been supplied.
 #include <ee/operator.hpp>
 #include <ee/boolean.hpp>
 #include <ee/real.hpp>
+#include <ee/evaluation_budget.hpp>
+#include <ee/trace.hpp>
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 using namespace std;
 
 
 
 // Convert Integer value to a string for display
 [[nodiscard]] Integer::string_type Integer::str() const {
+    TraceSpan span("to string", "kernel");
     return value().str();
 }
 
 // Factorial function implementation
 Integer::value_type Integer::factorial(value_type n) {
+    TraceSpan span("factorial", "kernel");
+    return product(2, factorial_terms(n));
+}
+
+std::uint64_t Integer::factorial_terms(value_type const& n) {
     if (n < 0) {
         throw std::runtime_error("Factorial is not defined for negative integers.");
     }
+    if (n > std::numeric_limits<std::uint64_t>::max()) {
+        throw std::runtime_error("Error: factorial argument too large");
+    }
+    auto const count = n.convert_to<std::uint64_t>();
+    if (auto budget = EvaluationBudget::current()) {
+        // log2(n!) = lgamma(n + 1) / ln 2
+        budget->check_bits(std::lgamma(static_cast<double>(count) + 1) / std::log(2.0));
+        budget->check_operations(static_cast<double>(count));
+    }
+    return count;
+}
+
+Integer::value_type Integer::product(std::uint64_t first, std::uint64_t last) {
     value_type result = 1;
-    for (value_type i = 1; i <= n; ++i) {
+    for (std::uint64_t i = first; i <= last && i != 0; ++i) {
         result *= i;
+        EvaluationBudget::checkpoint();
     }
     return result;
 }
 
 // Power function implementation
 Integer::value_type Integer::power(value_type base, value_type exponent) {
-    if (exponent < 0) {
+    TraceSpan span("pow", "kernel");
+    PowerSteps steps(std::move(base), std::move(exponent));
+    while (!steps.done()) {
+        steps.step();
+    }
+    return steps.result();
+}
+
+Integer::PowerSteps::PowerSteps(value_type base, value_type exponent) : base_(std::move(base)), exponent_(std::move(exponent)) {
+    if (exponent_ < 0) {
         throw std::runtime_error("Power with negative exponent is not supported for integers.");
     }
-    value_type result = 1;
-    while (exponent > 0) {
-        if (exponent % 2 == 1) {
-            result *= base;
-        }
-        base *= base;
-        exponent /= 2;
+    if (boost::multiprecision::abs(base_) <= 1) {
+        // 0, 1 and -1: no need to loop over a possibly enormous exponent
+        result_ = exponent_ == 0 || base_ == 1 ? 1 : base_ == 0 ? 0 : exponent_ % 2 == 0 ? 1 : -1;
+        exponent_ = 0;
+        return;
     }
-    return result;
+    // the result has more than msb(|base|) * exponent bits
+    EvaluationBudget::check_current_bits(static_cast<double>(boost::multiprecision::msb(boost::multiprecision::abs(base_))) * exponent_.convert_to<double>() + 1);
+}
+
+void Integer::PowerSteps::step() {
+    if (exponent_ % 2 == 1) {
+        result_ *= base_;
+    }
+    exponent_ /= 2;
+    if (exponent_ > 0) {
+        base_ *= base_;
+    }
+    EvaluationBudget::checkpoint();
 }
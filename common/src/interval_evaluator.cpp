@@ -0,0 +1,232 @@
+/*! \file interval_evaluator.cpp
+    \brief IntervalEvaluator class implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/interval_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+#include <ee/operator.hpp>
+#include <ee/function.hpp>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+
+namespace {
+    using Value = IntervalEvaluator::Value;
+
+    /*! Exact integer value, if it is still within the double-exact range. */
+    std::optional<Value> exact_integer(double x) {
+        if (!(std::abs(x) < IntervalEvaluator::max_exact_integer))
+            return std::nullopt;
+        return Value{ Interval(x), true };
+    }
+
+    /*! Enclosure of a Real operand. */
+    std::optional<Value> enclose(Real::value_type const& x) {
+        double const d = x.convert_to<double>();
+        if (!std::isfinite(d))
+            return std::nullopt;
+        if (Real::value_type(d) == x)
+            return Value{ Interval(d), false };
+        return Value{ Interval(d).widened(), false };
+    }
+
+    /*! Enclosure of an Integer operand. */
+    std::optional<Value> enclose(Integer::value_type const& x) {
+        if (boost::multiprecision::abs(x) >= Integer::value_type(9007199254740992LL))
+            return std::nullopt;
+        return Value{ Interval(x.convert_to<double>()), true };
+    }
+
+    /*! Lifts an optional interval into a Real stack value. */
+    std::optional<Value> real(Interval::optional_type const& iv) {
+        if (!iv || !iv->is_finite())
+            return std::nullopt;
+        return Value{ *iv, false };
+    }
+}
+
+
+
+[[nodiscard]] IntervalEvaluator::result_type IntervalEvaluator::evaluate(TokenList const& rpnExpression) const {
+    std::vector<Value> stack;
+    stack.reserve(rpnExpression.size());
+
+    auto pop = [&stack]() { Value v = stack.back(); stack.pop_back(); return v; };
+
+    for (auto const& token : rpnExpression) {
+        std::optional<Value> result;
+
+        if (is<Integer>(token)) {
+            result = enclose(convert<Integer>(token)->value());
+        }
+        else if (is<Real>(token)) {
+            result = enclose(convert<Real>(token)->value());
+        }
+        else if (is<Operator>(token) || is<Function>(token)) {
+            auto const arity = convert<Operation>(token)->number_of_args();
+            if (stack.size() < arity)
+                return std::nullopt;
+
+            if (arity == 1) {
+                auto const a = pop();
+                auto const& x = a.interval;
+                if (is<Identity>(token)) {
+                    result = a;
+                }
+                else if (is<Negation>(token)) {
+                    result = Value{ -x, a.integer };
+                }
+                else if (is<Factorial>(token)) {
+                    // 18! is the largest factorial below 2^53
+                    if (!a.integer || x.lo() < 0 || x.lo() > 18)
+                        return std::nullopt;
+                    double f = 1;
+                    for (int i = 2; i <= static_cast<int>(x.lo()); ++i)
+                        f *= i;
+                    result = Value{ Interval(f), true };
+                }
+                else if (is<Abs>(token)) {
+                    result = Value{ abs(x), a.integer };
+                }
+                else if (a.integer) {
+                    // the remaining functions require a Real operand
+                    return std::nullopt;
+                }
+                else if (is<Arccos>(token))	result = real(acos(x));
+                else if (is<Arcsin>(token))	result = real(asin(x));
+                else if (is<Arctan>(token))	result = real(atan(x));
+                else if (is<Ceil>(token))	result = real(ceil(x));
+                else if (is<Floor>(token))	result = real(floor(x));
+                else if (is<Cos>(token))	result = real(cos(x));
+                else if (is<Sin>(token))	result = real(sin(x));
+                else if (is<Tan>(token))	result = real(tan(x));
+                else if (is<Exp>(token))	result = real(exp(x));
+                else if (is<Ln>(token))		result = real(log(x));
+                else if (is<Lb>(token))		result = real(log2(x));
+                else if (is<Log>(token))	result = real(log10(x));
+                else if (is<Sqrt>(token))	result = real(sqrt(x));
+                else
+                    return std::nullopt;
+            }
+            else if (arity == 2) {
+                auto const b = pop();
+                auto const a = pop();
+                auto const& x = a.interval;
+                auto const& y = b.interval;
+                bool const integers = a.integer && b.integer;
+
+                if (is<Addition>(token)) {
+                    result = integers ? exact_integer(x.lo() + y.lo()) : real(x + y);
+                }
+                else if (is<Subtraction>(token)) {
+                    result = integers ? exact_integer(x.lo() - y.lo()) : real(x - y);
+                }
+                else if (is<Multiplication>(token)) {
+                    result = integers ? exact_integer(x.lo() * y.lo()) : real(x * y);
+                }
+                else if (is<Division>(token)) {
+                    if (integers) {
+                        if (y.lo() == 0)
+                            return std::nullopt;
+                        // truncating division, computed exactly from the remainder
+                        result = exact_integer((x.lo() - std::fmod(x.lo(), y.lo())) / y.lo());
+                    }
+                    else
+                        result = real(divide(x, y));
+                }
+                else if (is<Modulus>(token)) {
+                    if (!integers || y.lo() == 0)
+                        return std::nullopt;
+                    result = exact_integer(std::fmod(x.lo(), y.lo()));
+                }
+                else if (is<Power>(token) || is<Pow>(token)) {
+                    if (integers && y.lo() >= 0) {
+                        if (y.lo() > 64 && std::abs(x.lo()) > 1)
+                            return std::nullopt;
+                        double p = 1;
+                        for (long long n = std::min(static_cast<long long>(y.lo()), 64LL); n > 0 && std::abs(p) < max_exact_integer; --n)
+                            p *= x.lo();
+                        if (y.lo() > 64 && x.lo() == -1)
+                            p = std::fmod(y.lo(), 2) == 0 ? 1 : -1;
+                        result = exact_integer(p);
+                    }
+                    else if (integers && is<Pow>(token))
+                        return std::nullopt;	// the exact evaluator has no negative exponent rule for pow()
+                    else if (b.integer && std::abs(y.lo()) <= 64)
+                        result = real(pow(x, static_cast<long long>(y.lo())));
+                    else
+                        result = real(pow(x, y));
+                }
+                else if (is<Max>(token)) {
+                    result = Value{ max(x, y), integers };
+                }
+                else if (is<Min>(token)) {
+                    result = Value{ min(x, y), integers };
+                }
+                else if (is<Arctan2>(token)) {
+                    // a is the change in y, b the change in x; only the right half-plane is monotone
+                    if (a.integer || b.integer || y.lo() <= 0)
+                        return std::nullopt;
+                    auto q = divide(x, y);
+                    if (!q)
+                        return std::nullopt;
+                    result = real(atan(*q));
+                }
+                else
+                    return std::nullopt;
+            }
+            else
+                return std::nullopt;
+        }
+        else {
+            // variables, booleans and pseudo-operations are left to the exact evaluator
+            return std::nullopt;
+        }
+
+        if (!result)
+            return std::nullopt;
+        stack.push_back(*result);
+    }
+
+    if (stack.size() != 1)
+        return std::nullopt;
+    return stack.back();
+}
+
+
+
+[[nodiscard]] Operand::pointer_type IntervalEvaluator::certify(Value const& value, unsigned digits) {
+    auto const& iv = value.interval;
+    if (value.integer)
+        return std::make_shared<Integer>(Integer::value_type(static_cast<long long>(iv.lo())));
+
+    if (digits == 0 || digits > max_digits)
+        return nullptr;
+    if (iv.is_point() && iv.lo() == 0)
+        return std::make_shared<Real>(Real::value_type(0));
+
+    // both bounds must share a sign and agree to within one unit in the last requested digit
+    if (!(iv.lo() > 0 || iv.hi() < 0))
+        return nullptr;
+    auto const magnitude = std::min(std::abs(iv.lo()), std::abs(iv.hi()));
+    if (iv.width() > magnitude * std::pow(10.0, -static_cast<int>(digits)))
+        return nullptr;
+
+    std::ostringstream oss;
+    oss << std::scientific << std::setprecision(digits - 1) << iv.mid();
+    return std::make_shared<Real>(Real::value_type(oss.str()));
+}
@@ -0,0 +1,323 @@
+/*! \file jit.cpp
+    \brief JitFunction class implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/jit.hpp>
+#include <ee/RPNEvaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+#include <ee/operator.hpp>
+#include <ee/function.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define EE_JIT_X64 1
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+#endif
+
+
+#if defined(EE_JIT_X64)
+namespace {
+    // C library entry points with a single, unambiguous signature.
+    double jit_exp(double x) { return std::exp(x); }
+    double jit_log(double x) { return std::log(x); }
+    double jit_log2(double x) { return std::log2(x); }
+    double jit_log10(double x) { return std::log10(x); }
+    double jit_sin(double x) { return std::sin(x); }
+    double jit_cos(double x) { return std::cos(x); }
+    double jit_tan(double x) { return std::tan(x); }
+    double jit_asin(double x) { return std::asin(x); }
+    double jit_acos(double x) { return std::acos(x); }
+    double jit_atan(double x) { return std::atan(x); }
+    double jit_ceil(double x) { return std::ceil(x); }
+    double jit_floor(double x) { return std::floor(x); }
+    double jit_pow(double x, double y) { return std::pow(x, y); }
+    double jit_atan2(double y, double x) { return std::atan2(y, x); }
+
+
+
+    /*! Minimal x86-64 encoder for the instructions the code generator needs.
+        Operand slots are addressed as [rsp + disp32]; arguments as [rbx + disp32]. */
+    class Assembler {
+    public:
+        std::vector<std::uint8_t> code;
+
+        void bytes(std::initializer_list<std::uint8_t> b) { code.insert(code.end(), b); }
+        void imm32(std::int32_t v) { for (int i = 0; i < 4; ++i) code.push_back(static_cast<std::uint8_t>(v >> (8 * i))); }
+        void imm64(std::uint64_t v) { for (int i = 0; i < 8; ++i) code.push_back(static_cast<std::uint8_t>(v >> (8 * i))); }
+        void patch32(std::size_t at, std::int32_t v) { for (int i = 0; i < 4; ++i) code[at + i] = static_cast<std::uint8_t>(v >> (8 * i)); }
+
+        // <op>sd xmm<reg>, [rsp + disp]    (F2 0F op /r with SIB base rsp)
+        void sse_rsp(std::uint8_t op, int reg, std::int32_t disp) { bytes({ 0xF2, 0x0F, op, static_cast<std::uint8_t>(0x84 | (reg << 3)), 0x24 }); imm32(disp); }
+        void load_xmm(int reg, std::int32_t disp) { sse_rsp(0x10, reg, disp); }
+        void store_xmm0(std::int32_t disp) { bytes({ 0xF2, 0x0F, 0x11, 0x84, 0x24 }); imm32(disp); }
+
+        void mov_rax_imm(std::uint64_t v) { bytes({ 0x48, 0xB8 }); imm64(v); }
+        void load_rax(std::int32_t disp) { bytes({ 0x48, 0x8B, 0x84, 0x24 }); imm32(disp); }
+        void store_rax(std::int32_t disp) { bytes({ 0x48, 0x89, 0x84, 0x24 }); imm32(disp); }
+        void load_rax_arg(std::int32_t disp) { bytes({ 0x48, 0x8B, 0x83 }); imm32(disp); }
+        void flip_sign_rax() { bytes({ 0x48, 0x0F, 0xBA, 0xF8, 0x3F }); }   // btc rax, 63
+        void clear_sign_rax() { bytes({ 0x48, 0x0F, 0xBA, 0xF0, 0x3F }); }  // btr rax, 63
+        void call(void const* fn) { mov_rax_imm(reinterpret_cast<std::uintptr_t>(fn)); bytes({ 0xFF, 0xD0 }); }
+    };
+
+
+
+    /*! A compile-time stack entry: either a literal (still foldable) or a value in its slot. */
+    struct Item {
+        Operand::pointer_type constant;     // nullptr once the value lives in the slot
+    };
+
+    // Win64 requires 32 bytes of shadow space above the return address for callees.
+    constexpr std::int32_t shadow_space = 32;
+    constexpr std::int32_t slot(std::size_t depth) { return shadow_space + static_cast<std::int32_t>(8 * depth); }
+
+    /*! The double value of a literal, if it is representable without leaving the exact range. */
+    bool to_double(Operand::pointer_type const& operand, double& result) {
+        if (is<Integer>(operand)) {
+            auto const v = convert<Integer>(operand)->value();
+            if (boost::multiprecision::abs(v) > Integer::value_type(9007199254740992LL))
+                return false;
+            result = v.convert_to<double>();
+            return true;
+        }
+        if (is<Real>(operand)) {
+            result = convert<Real>(operand)->value().convert_to<double>();
+            return std::isfinite(result);
+        }
+        return false;
+    }
+
+    void const* unary_function(Token::pointer_type const& token) {
+        if (is<Exp>(token)) return reinterpret_cast<void const*>(&jit_exp);
+        if (is<Ln>(token)) return reinterpret_cast<void const*>(&jit_log);
+        if (is<Lb>(token)) return reinterpret_cast<void const*>(&jit_log2);
+        if (is<Log>(token)) return reinterpret_cast<void const*>(&jit_log10);
+        if (is<Sin>(token)) return reinterpret_cast<void const*>(&jit_sin);
+        if (is<Cos>(token)) return reinterpret_cast<void const*>(&jit_cos);
+        if (is<Tan>(token)) return reinterpret_cast<void const*>(&jit_tan);
+        if (is<Arcsin>(token)) return reinterpret_cast<void const*>(&jit_asin);
+        if (is<Arccos>(token)) return reinterpret_cast<void const*>(&jit_acos);
+        if (is<Arctan>(token)) return reinterpret_cast<void const*>(&jit_atan);
+        if (is<Ceil>(token)) return reinterpret_cast<void const*>(&jit_ceil);
+        if (is<Floor>(token)) return reinterpret_cast<void const*>(&jit_floor);
+        return nullptr;
+    }
+
+    /*! SSE2 opcode for the binary operators that map onto a single instruction, or 0. */
+    std::uint8_t binary_opcode(Token::pointer_type const& token) {
+        if (is<Addition>(token)) return 0x58;
+        if (is<Multiplication>(token)) return 0x59;
+        if (is<Subtraction>(token)) return 0x5C;
+        if (is<Min>(token)) return 0x5D;
+        if (is<Division>(token)) return 0x5E;
+        if (is<Max>(token)) return 0x5F;
+        return 0;
+    }
+}
+#endif // EE_JIT_X64
+
+
+
+JitFunction::~JitFunction() {
+#if defined(EE_JIT_X64)
+    if (code_m) {
+#if defined(_WIN32)
+        VirtualFree(code_m, 0, MEM_RELEASE);
+#else
+        munmap(code_m, size_m);
+#endif
+    }
+#endif
+}
+
+
+
+[[nodiscard]] JitFunction::pointer_type JitFunction::compile(TokenList const& rpnExpression) {
+#if !defined(EE_JIT_X64)
+    (void)rpnExpression;
+    return nullptr;
+#else
+    if (rpnExpression.empty())
+        return nullptr;
+
+    pointer_type fn(new JitFunction);
+    Assembler a;
+    std::vector<Item> stack;
+    std::size_t maxDepth = 1;
+
+    // prologue: push rbx; mov rbx, <first argument>; sub rsp, <frame>
+    a.bytes({ 0x53 });
+#if defined(_WIN32)
+    a.bytes({ 0x48, 0x89, 0xCB });
+#else
+    a.bytes({ 0x48, 0x89, 0xFB });
+#endif
+    a.bytes({ 0x48, 0x81, 0xEC });
+    auto const framePatch = a.code.size();
+    a.imm32(0);
+
+    auto materialize = [&](std::size_t depth) {
+        auto& item = stack[depth];
+        if (!item.constant)
+            return true;
+        double d;
+        if (!to_double(item.constant, d))
+            return false;
+        std::uint64_t bits;
+        std::memcpy(&bits, &d, sizeof bits);
+        a.mov_rax_imm(bits);
+        a.store_rax(slot(depth));
+        item.constant = nullptr;
+        return true;
+    };
+
+    for (auto const& token : rpnExpression) {
+        if (is<Variable>(token)) {
+            auto const var = convert<Variable>(token);
+            auto const found = std::find(fn->variables_m.begin(), fn->variables_m.end(), var);
+            auto const index = static_cast<std::int32_t>(found - fn->variables_m.begin());
+            if (found == fn->variables_m.end())
+                fn->variables_m.push_back(var);
+            a.load_rax_arg(8 * index);
+            a.store_rax(slot(stack.size()));
+            stack.push_back(Item{});
+        }
+        else if (is<Integer>(token) || is<Real>(token)) {
+            stack.push_back(Item{ convert<Operand>(token) });
+        }
+        else if (is<Operator>(token) || is<Function>(token)) {
+            if (is<Assignment>(token) || is<Factorial>(token))
+                return nullptr;
+
+            auto const arity = convert<Operation>(token)->number_of_args();
+            if (arity == 0 || stack.size() < arity)
+                return nullptr;
+            auto const top = stack.size() - arity;
+
+            // literal operands only: fold with the exact evaluator
+            if (std::all_of(stack.begin() + top, stack.end(), [](Item const& i) { return i.constant != nullptr; })) {
+                TokenList sub;
+                for (auto i = top; i < stack.size(); ++i)
+                    sub.push_back(stack[i].constant);
+                sub.push_back(token);
+                Operand::pointer_type folded;
+                try {
+                    folded = RPNEvaluator().evaluate(sub);
+                }
+                catch (std::exception const&) {
+                    return nullptr;
+                }
+                if (!is<Integer>(folded) && !is<Real>(folded))
+                    return nullptr;
+                stack.resize(top);
+                stack.push_back(Item{ folded });
+                continue;
+            }
+
+            for (auto i = top; i < stack.size(); ++i)
+                if (!materialize(i))
+                    return nullptr;
+
+            if (arity == 1) {
+                if (is<Identity>(token)) {
+                }
+                else if (is<Negation>(token) || is<Abs>(token)) {
+                    a.load_rax(slot(top));
+                    if (is<Negation>(token)) a.flip_sign_rax(); else a.clear_sign_rax();
+                    a.store_rax(slot(top));
+                }
+                else if (is<Sqrt>(token)) {
+                    a.sse_rsp(0x51, 0, slot(top));
+                    a.store_xmm0(slot(top));
+                }
+                else if (auto f = unary_function(token)) {
+                    a.load_xmm(0, slot(top));
+                    a.call(f);
+                    a.store_xmm0(slot(top));
+                }
+                else
+                    return nullptr;
+            }
+            else if (arity == 2) {
+                if (auto op = binary_opcode(token)) {
+                    a.load_xmm(0, slot(top));
+                    a.sse_rsp(op, 0, slot(top + 1));
+                    a.store_xmm0(slot(top));
+                }
+                else if (is<Power>(token) || is<Pow>(token) || is<Arctan2>(token)) {
+                    a.load_xmm(0, slot(top));
+                    a.load_xmm(1, slot(top + 1));
+                    a.call(is<Arctan2>(token) ? reinterpret_cast<void const*>(&jit_atan2) : reinterpret_cast<void const*>(&jit_pow));
+                    a.store_xmm0(slot(top));
+                }
+                else
+                    return nullptr;
+                stack.pop_back();
+            }
+            else
+                return nullptr;
+        }
+        else
+            return nullptr;
+
+        maxDepth = std::max(maxDepth, stack.size());
+    }
+
+    if (stack.size() != 1 || !materialize(0))
+        return nullptr;
+
+    // epilogue: movsd xmm0, [slot 0]; add rsp, <frame>; pop rbx; ret
+    // The frame keeps rsp 16-byte aligned at each call (entry rsp is 8 mod 16, push rbx realigns).
+    auto const frame = (slot(maxDepth) + 15) & ~15;
+    a.load_xmm(0, slot(0));
+    a.bytes({ 0x48, 0x81, 0xC4 });
+    a.imm32(frame);
+    a.bytes({ 0x5B, 0xC3 });
+    a.patch32(framePatch, frame);
+
+    // copy into executable memory; writable and executable are never set together
+    fn->size_m = a.code.size();
+#if defined(_WIN32)
+    fn->code_m = VirtualAlloc(nullptr, fn->size_m, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (!fn->code_m)
+        return nullptr;
+    std::memcpy(fn->code_m, a.code.data(), fn->size_m);
+    DWORD oldProtection;
+    if (!VirtualProtect(fn->code_m, fn->size_m, PAGE_EXECUTE_READ, &oldProtection))
+        return nullptr;
+    FlushInstructionCache(GetCurrentProcess(), fn->code_m, fn->size_m);
+#else
+    void* mem = mmap(nullptr, fn->size_m, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED)
+        return nullptr;
+    fn->code_m = mem;
+    std::memcpy(fn->code_m, a.code.data(), fn->size_m);
+    if (mprotect(fn->code_m, fn->size_m, PROT_READ | PROT_EXEC) != 0)
+        return nullptr;
+#endif
+    fn->entry_m = reinterpret_cast<signature_type>(fn->code_m);
+    return fn;
+#endif // EE_JIT_X64
+}
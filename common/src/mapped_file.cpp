@@ -0,0 +1,100 @@
+/*! \file mapped_file.cpp
+    \brief MappedFile class implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/mapped_file.hpp>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(std::string const& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("cannot open " + path);
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        throw std::runtime_error("cannot read the size of " + path);
+    }
+    if (size.QuadPart == 0) {
+        CloseHandle(file);
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        throw std::runtime_error("cannot map " + path);
+    data_m = static_cast<char const*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (data_m == nullptr)
+        throw std::runtime_error("cannot map " + path);
+    size_m = static_cast<std::size_t>(size.QuadPart);
+}
+
+
+
+MappedFile::~MappedFile() {
+    if (data_m)
+        UnmapViewOfFile(data_m);
+}
+
+#else
+
+MappedFile::MappedFile(std::string const& path) {
+    int const fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("cannot open " + path);
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::runtime_error("cannot read the size of " + path);
+    }
+    if (info.st_size == 0) {
+        close(fd);
+        return;
+    }
+
+    void* data = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        throw std::runtime_error("cannot map " + path);
+    madvise(data, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+    data_m = static_cast<char const*>(data);
+    size_m = static_cast<std::size_t>(info.st_size);
+}
+
+
+
+MappedFile::~MappedFile() {
+    if (data_m)
+        munmap(const_cast<char*>(data_m), size_m);
+}
+
+#endif
@@ -0,0 +1,196 @@
+/*! \file operation_profiler.cpp
+    \brief OperationProfiler implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/operation_profiler.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+
+
+namespace {
+    // The unqualified class name of a type.
+    std::string class_name(std::type_index type) {
+#if defined(__GNUG__)
+        int status = 0;
+        std::unique_ptr<char, void (*)(void*)> const demangled(abi::__cxa_demangle(type.name(), nullptr, nullptr, &status), std::free);
+        std::string name = status == 0 ? demangled.get() : type.name();
+#else
+        std::string name = type.name();
+        for (std::string prefix : { "class ", "struct " })
+            if (name.starts_with(prefix))
+                name.erase(0, prefix.size());
+#endif
+        if (auto const colons = name.rfind("::"); colons != std::string::npos)
+            name.erase(0, colons + 2);
+        return name;
+    }
+
+    // The type of an operand, looking through a variable to its value.
+    std::type_index operand_type(Token const* operand) {
+        if (!operand)
+            return typeid(void);
+        if (auto const variable = dynamic_cast<Variable const*>(operand))
+            if (auto const value = variable->value())
+                return typeid(*value);
+        return typeid(*operand);
+    }
+
+    // The upper bound of the histogram bucket that holds the 'fraction' point of the samples.
+    std::uint64_t quantile(OperationProfiler::histogram_type const& histogram, std::uint64_t samples, double fraction) {
+        auto const target = static_cast<std::uint64_t>(fraction * static_cast<double>(samples));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < histogram.size(); ++i) {
+            seen += histogram[i];
+            if (seen > target)
+                return std::uint64_t(1) << i;
+        }
+        return std::uint64_t(1) << (histogram.size() - 1);
+    }
+
+    void sort_by_time(std::vector<OperationProfiler::Row>& rows) {
+        std::sort(rows.begin(), rows.end(), [](auto const& a, auto const& b) { return a.nanoseconds > b.nanoseconds; });
+    }
+
+    void write_rows(std::ostream& os, char const* title, std::vector<OperationProfiler::Row> const& rows) {
+        os << std::left << std::setw(34) << title << std::right
+            << std::setw(12) << "calls" << std::setw(14) << "total ms"
+            << std::setw(12) << "mean ns" << std::setw(12) << "p50 ns" << std::setw(12) << "p99 ns" << '\n';
+        for (auto const& row : rows) {
+            auto const name = row.operands.empty() ? row.operation : row.operation + "(" + row.operands + ")";
+            os << std::left << std::setw(34) << name << std::right
+                << std::setw(12) << row.calls
+                << std::setw(14) << std::fixed << std::setprecision(3) << static_cast<double>(row.nanoseconds) / 1e6
+                << std::setw(12) << std::setprecision(0) << row.meanNanoseconds
+                << std::setw(12) << "<" + std::to_string(row.medianNanoseconds)
+                << std::setw(12) << "<" + std::to_string(row.p99Nanoseconds) << '\n';
+        }
+    }
+}
+
+
+
+OperationProfiler::OperationProfiler(unsigned period) : period_m(period), countdown_m(1) {
+    if (period == 0)
+        throw std::invalid_argument("Error: the profiler period must be at least 1");
+    countdown_m = next_interval();
+}
+
+
+
+// Uniform on [1, 2 * period - 1], so the mean interval is the period.
+unsigned OperationProfiler::next_interval() {
+    if (period_m == 1)
+        return 1;
+    random_m ^= random_m << 13;     // xorshift64
+    random_m ^= random_m >> 7;
+    random_m ^= random_m << 17;
+    return 1 + static_cast<unsigned>(random_m % (2 * std::uint64_t(period_m) - 1));
+}
+
+
+
+void OperationProfiler::record(Token const& operation, Token const* first, Token const* second, std::chrono::nanoseconds elapsed) {
+    auto& entry = entries_m[key_type(typeid(operation), operand_type(first), operand_type(second))];
+    auto const ns = static_cast<std::uint64_t>(std::max<std::chrono::nanoseconds::rep>(elapsed.count(), 0));
+    ++entry.samples;
+    entry.nanoseconds += ns;
+    ++entry.histogram[std::min<std::size_t>(std::bit_width(ns), buckets - 1)];
+}
+
+
+
+OperationProfiler::Row OperationProfiler::make_row(std::string operation, std::string operands, Entry const& entry) const {
+    Row row;
+    row.operation = std::move(operation);
+    row.operands = std::move(operands);
+    row.samples = entry.samples;
+    row.calls = entry.samples * period_m;
+    row.nanoseconds = entry.nanoseconds * period_m;
+    row.meanNanoseconds = entry.samples == 0 ? 0.0 : static_cast<double>(entry.nanoseconds) / static_cast<double>(entry.samples);
+    row.medianNanoseconds = quantile(entry.histogram, entry.samples, 0.5);
+    row.p99Nanoseconds = quantile(entry.histogram, entry.samples, 0.99);
+    row.histogram = entry.histogram;
+    return row;
+}
+
+
+
+std::vector<OperationProfiler::Row> OperationProfiler::rows() const {
+    std::vector<Row> result;
+    for (auto const& [key, entry] : entries_m) {
+        std::string operands;
+        for (auto const type : { std::get<1>(key), std::get<2>(key) })
+            if (type != typeid(void))
+                operands += (operands.empty() ? "" : ", ") + class_name(type);
+        result.push_back(make_row(class_name(std::get<0>(key)), std::move(operands), entry));
+    }
+    sort_by_time(result);
+    return result;
+}
+
+
+
+std::vector<OperationProfiler::Row> OperationProfiler::operations() const {
+    std::map<std::type_index, Entry> byOperation;
+    for (auto const& [key, entry] : entries_m) {
+        auto& total = byOperation[std::get<0>(key)];
+        total.samples += entry.samples;
+        total.nanoseconds += entry.nanoseconds;
+        for (std::size_t i = 0; i < buckets; ++i)
+            total.histogram[i] += entry.histogram[i];
+    }
+
+    std::vector<Row> result;
+    for (auto const& [operation, entry] : byOperation)
+        result.push_back(make_row(class_name(operation), {}, entry));
+    sort_by_time(result);
+    return result;
+}
+
+
+
+void OperationProfiler::report(std::ostream& os) const {
+    std::ostringstream table;      // leaves the caller's stream formatting alone
+    if (period_m != 1)
+        table << "sampled 1 in " << period_m << "; calls and times are estimates\n";
+    write_rows(table, "operation", operations());
+    table << '\n';
+    write_rows(table, "operation(operands)", rows());
+    os << table.str();
+}
+
+
+
+void OperationProfiler::merge(OperationProfiler const& other) {
+    if (other.period_m != period_m)
+        throw std::invalid_argument("Error: cannot merge profilers with different periods");
+    for (auto const& [key, entry] : other.entries_m) {
+        auto& mine = entries_m[key];
+        mine.samples += entry.samples;
+        mine.nanoseconds += entry.nanoseconds;
+        for (std::size_t i = 0; i < buckets; ++i)
+            mine.histogram[i] += entry.histogram[i];
+    }
+}
@@ -0,0 +1,178 @@
+/*! \file parallel_batch.cpp
+    \brief ParallelBatch class implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+    Every evaluator runs under the batch's limits.
+
+============================================================= */
+
+#include <ee/parallel_batch.hpp>
+#include <ee/batch_io.hpp>
+#include <ee/expression_evaluator.hpp>
+#include <ee/variable.hpp>
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace {
+    enum class State { pending, done, stateful };
+
+    struct Piece {
+        std::string_view text;
+        std::size_t      firstLine = 0;
+        std::string      output{};
+        std::size_t      lines = 0;
+        std::size_t      failures = 0;
+        State            state = State::pending;
+    };
+
+    [[nodiscard]] bool is_blank(std::string_view line) {
+        return std::all_of(line.begin(), line.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; });
+    }
+
+    /*! Evaluates the non-blank lines of 'text', appending to 'piece'.  Returns false, having
+        stopped, at the first line naming a variable when 'stateless' is set. */
+    bool evaluate_lines(ExpressionEvaluator& evaluator, std::string_view text, std::size_t lineNumber, Piece& piece, bool stateless) {
+        bool clean = true;
+        for_each_line(text, [&](std::string_view line) {
+            if (!clean)
+                return;
+            auto const number = lineNumber++;
+            if (is_blank(line))
+                return;
+            try {
+                auto const rpn = evaluator.compile(line);
+                if (stateless && std::any_of(rpn.begin(), rpn.end(), [](Token::pointer_type const& t) { return is<Variable>(t); })) {
+                    clean = false;
+                    return;
+                }
+                piece.output += evaluator.run(rpn)->str();
+                piece.output += '\n';
+            }
+            catch (std::exception const& ex) {
+                ++piece.failures;
+                piece.output += "Error: line " + std::to_string(number) + ": " + ex.what() + "\n";
+            }
+            catch (...) {
+                ++piece.failures;
+                piece.output += "Error: line " + std::to_string(number) + ": unknown error\n";
+            }
+            ++piece.lines;
+        });
+        return clean;
+    }
+}
+
+
+
+ParallelBatch::ParallelBatch(unsigned jobs) : jobs_m(jobs) {
+    if (jobs_m == 0)
+        jobs_m = std::max(1u, std::thread::hardware_concurrency());
+}
+
+
+
+std::size_t ParallelBatch::run(std::string_view text, std::FILE* output) {
+    std::vector<Piece> pieces;
+    for (auto piece : split_lines(text, std::max<std::size_t>(jobs_m, text.size() / batch_buffer_size)))
+        pieces.push_back(Piece{ piece });
+    for (std::size_t i = 1; i < pieces.size(); ++i)
+        pieces[i].firstLine = pieces[i - 1].firstLine + count_lines(pieces[i - 1].text);
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::size_t next = 0, written = 0;
+    bool stop = false;
+    std::size_t const window = 2 * static_cast<std::size_t>(jobs_m);
+
+    auto worker = [&] {
+        ExpressionEvaluator evaluator;
+        evaluator.rpn_evaluator().budget().set_limits(limits_m);
+        for (;;) {
+            std::size_t i;
+            {
+                std::unique_lock lock(mutex);
+                changed.wait(lock, [&] { return stop || next >= pieces.size() || next < written + window; });
+                if (stop || next >= pieces.size())
+                    return;
+                i = next++;
+            }
+            Piece result{ pieces[i].text, pieces[i].firstLine };
+            bool const clean = evaluate_lines(evaluator, result.text, result.firstLine + 1, result, true);
+            {
+                std::lock_guard lock(mutex);
+                pieces[i].output = std::move(result.output);
+                pieces[i].lines = result.lines;
+                pieces[i].failures = result.failures;
+                pieces[i].state = clean ? State::done : State::stateful;
+                if (!clean)
+                    stop = true;
+            }
+            changed.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned j = 0; j < jobs_m; ++j)
+        workers.emplace_back(worker);
+
+    lines_m = failures_m = 0;
+    sequential_m = false;
+    BufferedWriter writer(output);
+    std::size_t resume = pieces.size();
+    for (std::size_t i = 0; i < pieces.size(); ++i) {
+        std::string chunk;
+        {
+            std::unique_lock lock(mutex);
+            changed.wait(lock, [&] { return pieces[i].state != State::pending || (stop && i >= next); });
+            if (pieces[i].state != State::done) {
+                resume = i;
+                break;
+            }
+            chunk = std::move(pieces[i].output);
+            lines_m += pieces[i].lines;
+            failures_m += pieces[i].failures;
+            written = i + 1;
+        }
+        changed.notify_all();
+        writer.write(chunk);
+    }
+    {
+        std::lock_guard lock(mutex);
+        stop = true;
+    }
+    changed.notify_all();
+    for (auto& w : workers)
+        w.join();
+
+    if (resume < pieces.size()) {
+        sequential_m = true;
+        ExpressionEvaluator evaluator;
+        evaluator.rpn_evaluator().budget().set_limits(limits_m);
+        for (std::size_t i = resume; i < pieces.size(); ++i) {
+            Piece piece{ pieces[i].text, pieces[i].firstLine };
+            evaluate_lines(evaluator, piece.text, piece.firstLine + 1, piece, false);
+            writer.write(piece.output);
+            lines_m += piece.lines;
+            failures_m += piece.failures;
+        }
+    }
+
+    writer.flush();
+    if (writer.failed())
+        ++failures_m;
+    return failures_m;
+}
@@ -12,6 +12,9 @@ the subclasses Pi and E.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	str() records a trace span.
+
 Version 2021.10.26
 	C++ 20 validated
 
@@ -49,6 +52,7 @@ the program(s) have been supplied.
 #include <ee/boolean.hpp>
 #include <ee/function.hpp>
 #include <ee/operator.hpp>
+#include <ee/trace.hpp>
 #include <algorithm>
 #include <cassert>
 #include <cmath>
@@ -58,6 +62,7 @@ using namespace std;
 
 
 [[nodiscard]] Real::string_type Real::str() const {
+	TraceSpan span("to string", "kernel");
 	ostringstream oss;
 	oss << /*"Real: " << */fixed << setprecision(numeric_limits<value_type>::digits10) << value_;
 	return oss.str();
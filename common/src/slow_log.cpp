@@ -0,0 +1,190 @@
+/*! \file slow_log.cpp
+    \brief SlowLog implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/slow_log.hpp>
+#include <ee/boolean.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+#include <ee/variable.hpp>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+
+
+
+namespace {
+    using clock = std::chrono::steady_clock;
+
+    double microseconds(std::uint64_t nanoseconds) {
+        return static_cast<double>(nanoseconds) / 1000.0;
+    }
+
+    // 'text' as a JSON string, quotes included.
+    std::string json_string(std::string_view text) {
+        std::string json = "\"";
+        for (char c : text) {
+            if (c == '"' || c == '\\')
+                (json += '\\') += c;
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                char escape[8];
+                std::snprintf(escape, sizeof escape, "\\u%04x", static_cast<unsigned>(c));
+                json += escape;
+            }
+            else
+                json += c;
+        }
+        return json += '"';
+    }
+
+    // The message of a caught exception.
+    std::string message(std::exception_ptr failure) {
+        try {
+            std::rethrow_exception(failure);
+        }
+        catch (std::exception const& ex) {
+            return ex.what();
+        }
+        catch (...) {
+            return "unknown error";
+        }
+    }
+
+    // The type and size fields of a result, looking through a variable to its value.
+    std::string result_fields(Token::pointer_type const& result) {
+        Token const* value = result.get();
+        if (auto const variable = dynamic_cast<Variable const*>(value))
+            value = variable->value().get();
+        if (!value)
+            return {};
+
+        char fields[128];
+        if (auto const integer = dynamic_cast<Integer const*>(value)) {
+            auto const number = integer->value();
+            std::uint64_t digits = 1;
+            if (number != 0)
+                digits += static_cast<std::uint64_t>(static_cast<double>(boost::multiprecision::msb(abs(number))) * std::log10(2.0));
+            std::snprintf(fields, sizeof fields, R"(,"result":"Integer","digits":%llu,"limbs":%llu)",
+                static_cast<unsigned long long>(digits), static_cast<unsigned long long>(number.backend().size()));
+        }
+        else if (dynamic_cast<Real const*>(value))
+            std::snprintf(fields, sizeof fields, R"(,"result":"Real","digits":%d)", std::numeric_limits<Real::value_type>::digits10);
+        else if (dynamic_cast<Boolean const*>(value))
+            std::snprintf(fields, sizeof fields, R"(,"result":"Boolean")");
+        else
+            return {};
+        return fields;
+    }
+}
+
+
+
+SlowLog::SlowLog(std::string const& path, std::chrono::nanoseconds threshold, std::size_t queueEntries)
+    : threshold_m(threshold), profiler_m(1), queue_m(queueEntries) {
+    file_m.open(path, std::ios::binary | std::ios::app);
+    if (!file_m)
+        throw std::runtime_error("Error: cannot open slow log " + path);
+    writer_m = std::thread([this] { write_entries(); });
+}
+
+
+
+SlowLog::~SlowLog() {
+    {
+        std::lock_guard lock(mutex_m);
+        stopping_m = true;
+    }
+    wake_m.notify_one();
+    writer_m.join();
+}
+
+
+
+ExpressionEvaluator::result_type SlowLog::evaluate(ExpressionEvaluator& evaluator, std::string_view expr) {
+    auto& rpn = evaluator.rpn_evaluator();
+    auto const previous = rpn.profiler();
+    auto const before = evaluator.stats();
+    profiler_m.reset();
+    rpn.set_profiler(&profiler_m);
+
+    ExpressionEvaluator::result_type result;
+    std::exception_ptr failure;
+    auto const start = clock::now();
+    try {
+        result = evaluator.evaluate(expr);
+    }
+    catch (...) {
+        failure = std::current_exception();
+    }
+    auto const elapsed = clock::now() - start;
+    rpn.set_profiler(previous);
+
+    if (elapsed >= threshold_m) {
+        auto const& after = evaluator.stats();
+        auto const seconds = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+        char fields[256];
+        std::snprintf(fields, sizeof fields, R"({"time":%.3f,"elapsed_us":%.3f,"lex_us":%.3f,"parse_us":%.3f,"evaluate_us":%.3f,"expression":)",
+            seconds, microseconds(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())),
+            microseconds(after.lex.nanoseconds - before.lex.nanoseconds),
+            microseconds(after.parse.nanoseconds - before.parse.nanoseconds),
+            microseconds(after.evaluate.nanoseconds - before.evaluate.nanoseconds));
+        std::string line = fields + json_string(expr) + result_fields(result);
+
+        if (auto const operations = profiler_m.operations(); !operations.empty()) {
+            std::snprintf(fields, sizeof fields, R"(,"hottest_us":%.3f)", microseconds(operations.front().nanoseconds));
+            line += R"(,"hottest":)" + json_string(operations.front().operation) + fields;
+        }
+        if (failure)
+            line += R"(,"error":)" + json_string(message(failure));
+        push(std::move(line += '}'));
+    }
+
+    if (failure)
+        std::rethrow_exception(failure);
+    return result;
+}
+
+
+
+void SlowLog::push(std::string line) {
+    if (!queue_m.try_push(line)) {
+        ++dropped_m;
+        return;
+    }
+    ++logged_m;
+    wake_m.notify_one();
+}
+
+
+
+// The writer thread: appends the queued lines until the log is destroyed.
+void SlowLog::write_entries() {
+    std::unique_lock lock(mutex_m);
+    for (;;) {
+        bool const stopping = stopping_m;
+        std::string line;
+        bool wrote = false;
+        while (queue_m.try_pop(line)) {
+            file_m << line << '\n';
+            wrote = true;
+        }
+        if (wrote)
+            file_m.flush();
+        if (stopping)
+            return;
+        wake_m.wait_for(lock, std::chrono::milliseconds(50));
+    }
+}
@@ -9,6 +9,9 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	tokenize() takes a std::string_view.
+
 Version 2021.10.02
 	C++ 20 validated
 
@@ -113,7 +116,7 @@ Tokenizer::Tokenizer() {
 /** Get an identifier from the expression.
 	Assumes that the currentChar is pointing to a alphabetic.
 	*/
-Token::pointer_type Tokenizer::_get_identifier(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression) {
+Token::pointer_type Tokenizer::_get_identifier(Tokenizer::view_type::const_iterator& currentChar, Tokenizer::view_type expression) {
 	// accumulate identifier
 	string_type ident;
 	do
@@ -144,7 +147,7 @@ Token::pointer_type Tokenizer::_get_identifier(Tokenizer::string_type::const_ite
 	@param currentChar [in,out] an iterator to the current character.  Assumes that the currentChar is pointing to a digit.
 	@param expression [in] the expression being scanned.
 */
-Token::pointer_type Tokenizer::_get_number(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression) {
+Token::pointer_type Tokenizer::_get_number(Tokenizer::view_type::const_iterator& currentChar, Tokenizer::view_type expression) {
 	assert(isdigit(*currentChar) && "currentChar must pointer to a digit");
 
 	// Either Integer or Real
@@ -173,7 +176,7 @@ Token::pointer_type Tokenizer::_get_number(Tokenizer::string_type::const_iterato
 	@note Tokenizer dictionary may be updated if expression contains variables.
 	@note Will throws 'BadCharacter' if the expression contains an un-tokenizable character.
 	*/
-TokenList Tokenizer::tokenize(string_type const& expression) {
+TokenList Tokenizer::tokenize(view_type expression) {
 	TokenList tokenizedExpression;
 	auto currentChar = expression.cbegin();
 
@@ -236,7 +239,7 @@ TokenList Tokenizer::tokenize(string_type const& expression) {
 					continue;
 				}
 				else {
-					throw XBadCharacter(expression, currentChar - begin(expression));
+					throw XBadCharacter(string_type(expression), currentChar - begin(expression));
 				}
 			}
 
@@ -272,7 +275,7 @@ TokenList Tokenizer::tokenize(string_type const& expression) {
 		}
 
 		// Not a recognized token
-		throw XBadCharacter(expression, currentChar - begin(expression));
+		throw XBadCharacter(string_type(expression), currentChar - begin(expression));
 	}
 
 	return tokenizedExpression;
@@ -0,0 +1,188 @@
+/*! \file trace.cpp
+    \brief Tracer implementation.
+    \author Garth Santor
+    \date 2026-10-18
+    \copyright Garth Santor
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+    Alpha release.
+
+============================================================= */
+
+#include <ee/trace.hpp>
+#include <ee/spsc_queue.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+
+namespace {
+    struct Event {
+        char const*                 name = nullptr;
+        char const*                 category = nullptr;
+        Tracer::clock::time_point   begin, end;
+    };
+
+    // One thread's spans: that thread pushes, the flusher pops.
+    struct ThreadBuffer {
+        SpscQueue<Event>    events;
+        unsigned            tid;
+        std::atomic<bool>   finished{ false };     // the thread has exited
+        bool                named = false;          // its thread_name record is in the current trace
+
+        ThreadBuffer(std::size_t capacity, unsigned id) : events(capacity), tid(id) {}
+    };
+
+    struct State {
+        std::mutex                                  mutex;      // guards everything but 'dropped'
+        std::condition_variable                     wake;
+        std::vector<std::shared_ptr<ThreadBuffer>>  buffers;
+        std::size_t                                 capacity = Tracer::default_buffer_events;
+        unsigned                                    nextTid = 1;
+        std::ofstream                               file;
+        bool                                        first = true;
+        bool                                        running = false;
+        bool                                        stopping = false;
+        Tracer::clock::time_point                   epoch;
+        std::thread                                 flusher;
+        std::atomic<std::uint64_t>                  dropped{ 0 };
+    };
+
+    State& state() {
+        static State s;
+        return s;
+    }
+
+    // Marks the thread's buffer finished when the thread exits; the flusher then retires it.
+    struct BufferHolder {
+        std::shared_ptr<ThreadBuffer> buffer;
+        ~BufferHolder() {
+            if (buffer)
+                buffer->finished.store(true, std::memory_order_release);
+        }
+    };
+    thread_local BufferHolder holder;
+
+    double microseconds(Tracer::clock::duration d) {
+        return std::max(std::chrono::duration<double, std::micro>(d).count(), 0.0);
+    }
+
+    void write_record(State& s, char const* text) {
+        if (!s.first)
+            s.file << ",\n";
+        s.first = false;
+        s.file << text;
+    }
+
+    // Writes every buffered span and retires the buffers of exited threads.  Holds the mutex.
+    void drain(State& s) {
+        char text[512];
+        for (auto it = s.buffers.begin(); it != s.buffers.end(); ) {
+            auto& buffer = **it;
+            bool const finished = buffer.finished.load(std::memory_order_acquire);
+            Event event;
+            while (buffer.events.try_pop(event)) {
+                if (!buffer.named) {
+                    std::snprintf(text, sizeof text, R"({"name":"thread_name","ph":"M","pid":1,"tid":%u,"args":{"name":"thread %u"}})", buffer.tid, buffer.tid);
+                    write_record(s, text);
+                    buffer.named = true;
+                }
+                std::snprintf(text, sizeof text, R"({"name":"%s","cat":"%s","ph":"X","pid":1,"tid":%u,"ts":%.3f,"dur":%.3f})",
+                    event.name, event.category, buffer.tid, microseconds(event.begin - s.epoch), microseconds(event.end - event.begin));
+                write_record(s, text);
+            }
+            it = finished ? s.buffers.erase(it) : it + 1;
+        }
+    }
+}
+
+
+
+void Tracer::start(std::string const& path, std::size_t bufferEvents) {
+    auto& s = state();
+    std::lock_guard lock(s.mutex);
+    if (s.running)
+        throw std::runtime_error("Error: a trace is already running");
+    s.file.open(path, std::ios::binary | std::ios::trunc);
+    if (!s.file)
+        throw std::runtime_error("Error: cannot create trace file " + path);
+
+    // spans recorded after the last trace stopped belong to no trace
+    Event stale;
+    for (auto& buffer : s.buffers) {
+        while (buffer->events.try_pop(stale))
+            ;
+        buffer->named = false;
+    }
+    std::erase_if(s.buffers, [](auto const& buffer) { return buffer->finished.load(std::memory_order_acquire); });
+
+    s.capacity = bufferEvents == 0 ? 1 : bufferEvents;
+    s.epoch = clock::now();
+    s.first = true;
+    s.stopping = false;
+    s.running = true;
+    s.dropped.store(0, std::memory_order_relaxed);
+    s.file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    write_record(s, R"({"name":"process_name","ph":"M","pid":1,"args":{"name":"Expression Evaluator"}})");
+
+    s.flusher = std::thread([&s] {
+        std::unique_lock lock(s.mutex);
+        while (!s.stopping) {
+            s.wake.wait_for(lock, std::chrono::milliseconds(20));
+            drain(s);
+        }
+    });
+    enabled_s.store(true, std::memory_order_relaxed);
+}
+
+
+
+void Tracer::stop() {
+    auto& s = state();
+    {
+        std::lock_guard lock(s.mutex);
+        if (!s.running)
+            return;
+        enabled_s.store(false, std::memory_order_relaxed);
+        s.stopping = true;
+    }
+    s.wake.notify_one();
+    s.flusher.join();
+
+    std::lock_guard lock(s.mutex);
+    drain(s);
+    s.file << "\n]}\n";
+    s.file.close();
+    s.running = false;
+}
+
+
+
+std::uint64_t Tracer::dropped() {
+    return state().dropped.load(std::memory_order_relaxed);
+}
+
+
+
+void Tracer::record(char const* name, char const* category, clock::time_point begin, clock::time_point end) {
+    if (!holder.buffer) {
+        auto& s = state();
+        std::lock_guard lock(s.mutex);
+        holder.buffer = std::make_shared<ThreadBuffer>(s.capacity, s.nextTid++);
+        s.buffers.push_back(holder.buffer);
+    }
+    Event event{ name, category, begin, end };
+    if (!holder.buffer->events.try_push(event))
+        state().dropped.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,128 @@
+/*! \file	eec_main.cpp
+	\brief	ee-compile: ahead-of-time code generator for expressions.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Reads formulas, one per line, in the form
+
+	name: expression
+
+and writes a C++ header with one inline function per formula.
+Blank lines and lines starting with '#' are ignored.
+
+usage: ee-compile [--multiprecision] [--namespace ns] [-o header] [input]
+
+The input defaults to standard input and the header to standard
+output.  Errors are reported as 'input:line: message' and no
+header is written.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <gats/ConsoleApp.hpp>
+#include <ee/code_generator.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+
+
+namespace {
+	int usage() {
+		cerr << "usage: ee-compile [--multiprecision] [--namespace ns] [-o header] [input]\n";
+		return EXIT_FAILURE;
+	}
+
+	string trim(string const& s) {
+		auto const first = s.find_first_not_of(" \t\r");
+		if (first == string::npos)
+			return string();
+		return s.substr(first, s.find_last_not_of(" \t\r") - first + 1);
+	}
+}
+
+
+
+MAKEAPP(ee_compile) {
+	auto const& args = get_args();
+	auto types = CodeGenerator::Types::native;
+	string ns = "ee_compiled", inputName, outputName;
+
+	for (size_t i = 1; i < args.size(); ++i) {
+		if (args[i] == "--multiprecision")
+			types = CodeGenerator::Types::multiprecision;
+		else if (args[i] == "--namespace" && i + 1 < args.size())
+			ns = args[++i];
+		else if (args[i] == "-o" && i + 1 < args.size())
+			outputName = args[++i];
+		else if (!args[i].empty() && args[i][0] != '-' && inputName.empty())
+			inputName = args[i];
+		else
+			return usage();
+	}
+
+	ifstream inputFile;
+	if (!inputName.empty()) {
+		inputFile.open(inputName);
+		if (!inputFile) {
+			cerr << "ee-compile: cannot open " << inputName << endl;
+			return EXIT_FAILURE;
+		}
+	}
+	istream& input = inputName.empty() ? cin : inputFile;
+	string const source = inputName.empty() ? "<stdin>" : inputName;
+
+	CodeGenerator generator(types);
+	string line;
+	for (unsigned lineNumber = 1; getline(input, line); ++lineNumber) {
+		line = trim(line);
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		try {
+			auto const colon = line.find(':');
+			if (colon == string::npos)
+				throw runtime_error("expected 'name: expression'");
+			generator.add(trim(line.substr(0, colon)), trim(line.substr(colon + 1)));
+		}
+		catch (std::exception const& ex) {
+			cerr << source << ":" << lineNumber << ": " << ex.what() << endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	auto const header = generator.header(ns);
+	if (outputName.empty()) {
+		cout << header;
+		return EXIT_SUCCESS;
+	}
+
+	ofstream output(outputName);
+	if (!(output << header)) {
+		cerr << "ee-compile: cannot write " << outputName << endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,515 @@
+/*! \file	eef_main.cpp
+	\brief	ee-fuzz: searches for expressions that are slow or memory hungry to evaluate.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+Generates expressions from the evaluator's grammar (Integer, Real
+and Boolean operands, operators and functions) and mutates the
+costliest ones: growing literals, wrapping a subexpression in a
+factorial, a power or a function, repeating it, swapping an
+operator or splicing in a part of another expression.  Each
+candidate is evaluated once, by a fresh evaluator, and scored by
+its cost per input byte:
+
+	time		evaluation nanoseconds per byte (the default)
+	memory		peak heap bytes per byte
+
+The evaluations run under an EvaluationBudget, so a candidate
+cannot hang the search.  The first 'keep' candidates that exceed
+it are listed at the end of the corpus as comments; candidates
+that throw are discarded: the benchmarks time only expressions
+that evaluate.
+
+usage: ee-fuzz [--objective time|memory] [--iterations n] [--time seconds]
+			   [--budget ms] [--max-bits n] [--max-length bytes] [--keep n]
+			   [--seed n] [-o corpus] [seeds...]
+
+--time, if given, bounds the search instead of --iterations.
+The corpus (default fuzz_corpus.txt) holds the 'keep' costliest
+expressions, one per line, each after a comment with its cost.
+Only the costliest of expressions that differ in their literals
+and constants alone (e**e, e**2.5, pi**e) is kept.
+An existing corpus and the seed files (one expression per line,
+'#' comments) seed the search, so the corpus improves from run
+to run.  The benchmark suite times it with --corpus.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=============================================================
+
+Copyright Garth Santor / Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor / Trinh Han, Canada.
+The program(s) may be used and /or copied only with
+the written permission of Garth Santor / Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement / contract under which
+the program(s) have been supplied.
+============================================================= */
+
+#include <gats/ConsoleApp.hpp>
+#include <gats/TestApp.hpp>			// TestApp::count_allocations() (TestApp_alloc.cpp)
+#include <ee/boolean.hpp>
+#include <ee/expression_evaluator.hpp>
+#include <ee/integer.hpp>
+#include <ee/real.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+
+namespace {
+	using clock_type = chrono::steady_clock;
+
+	int usage() {
+		cerr << "usage: ee-fuzz [--objective time|memory] [--iterations n] [--time seconds]\n"
+				"               [--budget ms] [--max-bits n] [--max-length bytes] [--keep n]\n"
+				"               [--seed n] [-o corpus] [seeds...]\n";
+		return EXIT_FAILURE;
+	}
+
+	template <typename T>
+	bool parse_number(string const& text, T& value) {
+		return from_chars(text.data(), text.data() + text.size(), value).ptr == text.data() + text.size();
+	}
+
+	enum class Type { integer, real, boolean };
+
+	char const* const integer_operators[] = { "+", "-", "*", "/", "%", "mod", "**" };
+	char const* const real_operators[] = { "+", "-", "*", "/", "**" };
+	char const* const boolean_operators[] = { "and", "or", "xor", "nand", "nor", "xnor" };
+	char const* const relational_operators[] = { "==", "!=", "<", "<=", ">", ">=" };
+	char const* const real_functions[] = { "sin", "cos", "tan", "arcsin", "arccos", "arctan", "exp", "ln", "lb", "log", "sqrt", "ceil", "floor", "abs" };
+	char const* const real_functions2[] = { "pow", "arctan2", "max", "min" };
+	char const* const real_constants[] = { "pi", "e" };
+
+	/*! An expression tree, rendered to text for evaluation. */
+	struct Node {
+		enum class Kind { leaf, prefix, postfix, binary, call };
+		Kind			kind = Kind::leaf;
+		Type			type = Type::integer;
+		string			text;				// the literal, operator or function name
+		vector<Node>	children;
+	};
+
+	bool is_word(string const& op) { return isalpha(static_cast<unsigned char>(op.front())) != 0; }
+
+	string render(Node const& node);
+
+	// A child in parentheses, unless it is a leaf or a call.
+	string operand(Node const& child) {
+		auto const text = render(child);
+		return child.kind == Node::Kind::leaf || child.kind == Node::Kind::call ? text : "(" + text + ")";
+	}
+
+	string render(Node const& node) {
+		switch (node.kind) {
+		case Node::Kind::prefix:
+			return node.text + (is_word(node.text) ? " " : "") + operand(node.children[0]);
+		case Node::Kind::postfix:
+			return operand(node.children[0]) + node.text;
+		case Node::Kind::binary: {
+			string const space = is_word(node.text) ? " " : "";
+			return operand(node.children[0]) + space + node.text + space + operand(node.children[1]);
+		}
+		case Node::Kind::call: {
+			string text = node.text + "(";
+			for (size_t i = 0; i < node.children.size(); ++i)
+				text += (i ? "," : "") + render(node.children[i]);
+			return text + ")";
+		}
+		default:
+			return node.text;
+		}
+	}
+
+	// The nodes of 'root', root first.
+	template <typename N>
+	void collect(N& root, vector<N*>& nodes) {
+		nodes.push_back(&root);
+		for (auto& child : root.children)
+			collect(child, nodes);
+	}
+
+
+
+	/*! Random expressions from the grammar, and mutations of them. */
+	class Generator {
+	public:
+		explicit Generator(uint64_t seed) : random_m(seed) {}
+
+		size_t below(size_t n) { return uniform_int_distribution<size_t>(0, n - 1)(random_m); }
+		bool chance(double p) { return bernoulli_distribution(p)(random_m); }
+		Type any_type() { return static_cast<Type>(below(3)); }
+
+		Node generate(Type type, int depth) {
+			if (depth <= 0 || chance(0.3))
+				return leaf(type);
+			switch (type) {
+			case Type::integer:
+				switch (below(3)) {
+				case 0:		return postfix("!", leaf(Type::integer));
+				case 1:		return prefix("-", generate(Type::integer, depth - 1));
+				default:	return binary(type, integer_operators[below(size(integer_operators))], generate(Type::integer, depth - 1), generate(Type::integer, depth - 1));
+				}
+			case Type::real:
+				switch (below(3)) {
+				case 0:		return call(real_functions[below(size(real_functions))], { generate(Type::real, depth - 1) });
+				case 1:		return call(real_functions2[below(size(real_functions2))], { generate(Type::real, depth - 1), generate(Type::real, depth - 1) });
+				default:	return binary(type, real_operators[below(size(real_operators))], generate(Type::real, depth - 1), generate(chance(0.5) ? Type::real : Type::integer, depth - 1));
+				}
+			default:
+				switch (below(3)) {
+				case 0:		return prefix("not", generate(Type::boolean, depth - 1));
+				case 1: {
+					auto const operands = chance(0.5) ? Type::integer : Type::real;
+					return binary(type, relational_operators[below(size(relational_operators))], generate(operands, depth - 1), generate(operands, depth - 1));
+				}
+				default:	return binary(type, boolean_operators[below(size(boolean_operators))], generate(Type::boolean, depth - 1), generate(Type::boolean, depth - 1));
+				}
+			}
+		}
+
+		/*! 'tree' changed by one to three mutations; 'donor' supplies spliced subexpressions. */
+		Node mutate(Node tree, Node const& donor) {
+			for (auto n = 1 + below(3); n != 0; --n) {
+				vector<Node*> nodes;
+				collect(tree, nodes);
+				auto& node = *nodes[below(nodes.size())];
+				switch (below(6)) {
+				case 0:		// replace with a new subexpression
+					node = generate(node.type, 2);
+					break;
+				case 1:		// grow a literal, or lengthen its digits
+					if (node.kind == Node::Kind::leaf && isdigit(static_cast<unsigned char>(node.text.front())))
+						node.text.insert(node.text.begin() + static_cast<ptrdiff_t>(below(node.text.size() + 1)), static_cast<char>('1' + below(9)));
+					else
+						node = leaf(node.type);
+					break;
+				case 2:		// wrap: factorial, power or function
+					if (node.type == Type::integer)
+						node = chance(0.5) ? postfix("!", node) : binary(Type::integer, "**", node, leaf(Type::integer));
+					else if (node.type == Type::real)
+						node = call(real_functions[below(size(real_functions))], { node });
+					else
+						node = prefix("not", node);
+					break;
+				case 3: {	// repeat: node op node
+					auto const& operators = node.type == Type::boolean ? boolean_operators : node.type == Type::real ? real_operators : integer_operators;
+					auto const operatorCount = node.type == Type::boolean ? size(boolean_operators) : node.type == Type::real ? size(real_operators) : size(integer_operators);
+					node = binary(node.type, operators[below(operatorCount)], node, node);
+					break;
+				}
+				case 4:		// another operator or function of the same kind
+					if (node.kind == Node::Kind::binary)
+						node.text = swap_operator(node.text);
+					else if (node.kind == Node::Kind::call && node.children.size() == 1)
+						node.text = real_functions[below(size(real_functions))];
+					break;
+				default: {	// splice a subexpression of the donor, of the same type
+					vector<Node const*> donated;
+					collect(donor, donated);
+					vector<Node const*> matching;
+					for (auto candidate : donated)
+						if (candidate->type == node.type)
+							matching.push_back(candidate);
+					if (!matching.empty())
+						node = *matching[below(matching.size())];
+					break;
+				}
+				}
+			}
+			return tree;
+		}
+
+	private:
+		mt19937_64 random_m;
+
+		Node leaf(Type type) {
+			Node node;
+			node.type = type;
+			switch (type) {
+			case Type::integer:
+				node.text = digits(1 + below(chance(0.9) ? 3 : 30));
+				break;
+			case Type::real:
+				node.text = chance(0.2) ? real_constants[below(size(real_constants))] : digits(1 + below(3)) + "." + digits(1 + below(3));
+				break;
+			default:
+				node.text = chance(0.5) ? "true" : "false";
+			}
+			return node;
+		}
+
+		string digits(size_t n) {
+			string text(1, static_cast<char>('1' + below(9)));
+			while (text.size() < n)
+				text += static_cast<char>('0' + below(10));
+			return text;
+		}
+
+		static Node prefix(string op, Node child) {
+			auto const type = child.type;
+			return Node{ Node::Kind::prefix, type, move(op), { move(child) } };
+		}
+
+		static Node postfix(string op, Node child) {
+			auto const type = child.type;
+			return Node{ Node::Kind::postfix, type, move(op), { move(child) } };
+		}
+
+		static Node binary(Type type, string op, Node left, Node right) {
+			return Node{ Node::Kind::binary, type, move(op), { move(left), move(right) } };
+		}
+
+		static Node call(string function, vector<Node> arguments) {
+			return Node{ Node::Kind::call, Type::real, move(function), move(arguments) };
+		}
+
+		// An operator from the same table as 'op'.
+		string swap_operator(string const& op) {
+			for (auto table : { make_pair(integer_operators + 0, size(integer_operators)), make_pair(real_operators + 0, size(real_operators)),
+					make_pair(boolean_operators + 0, size(boolean_operators)), make_pair(relational_operators + 0, size(relational_operators)) })
+				if (find(table.first, table.first + table.second, op) != table.first + table.second)
+					return table.first[below(table.second)];
+			return op;
+		}
+	};
+
+
+
+	/*! What one evaluation cost. */
+	struct Cost {
+		double	nanoseconds = 0;
+		double	peakBytes = 0;
+		bool	overBudget = false;
+		bool	failed = false;
+		Type	type = Type::integer;
+	};
+
+	Cost measure(string const& expression, EvaluationBudget::Limits const& limits) {
+		ExpressionEvaluator evaluator;
+		evaluator.rpn_evaluator().budget().set_limits(limits);
+		gats::TestApp::AllocationStats allocations;
+		Cost cost;
+
+		gats::TestApp::count_allocations(&allocations);
+		auto const start = clock_type::now();
+		try {
+			auto const result = evaluator.evaluate(expression);
+			cost.type = dynamic_cast<Boolean const*>(result.get()) ? Type::boolean : dynamic_cast<Real const*>(result.get()) ? Type::real : Type::integer;
+		}
+		catch (BudgetExceeded const&) {
+			cost.overBudget = true;
+		}
+		catch (...) {
+			cost.failed = true;
+		}
+		cost.nanoseconds = static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(clock_type::now() - start).count());
+		gats::TestApp::count_allocations(nullptr);
+		cost.peakBytes = static_cast<double>(allocations.peakBytes);
+		return cost;
+	}
+
+	/*! 'expression' with its literals and constants masked, so that variations of one expression share a shape. */
+	string shape(string const& expression) {
+		auto const part_of_word = [](char c) { return isalnum(static_cast<unsigned char>(c)) || c == '.'; };
+		string result;
+		for (size_t i = 0; i < expression.size(); ) {
+			if (!part_of_word(expression[i])) {
+				result += expression[i++];
+				continue;
+			}
+			auto end = i;
+			while (end < expression.size() && part_of_word(expression[end]))
+				++end;
+			string word = expression.substr(i, end - i);
+			transform(word.begin(), word.end(), word.begin(), [](char c) { return static_cast<char>(tolower(static_cast<unsigned char>(c))); });
+			result += isdigit(static_cast<unsigned char>(word.front())) || word.front() == '.' || word == "e" || word == "pi" ? "#" : word;
+			i = end;
+		}
+		return result;
+	}
+
+	/*! A corpus member. */
+	struct Entry {
+		string	expression;
+		string	shape;
+		Node	tree;
+		Cost	cost;
+		double	score = 0;
+	};
+
+	/*! The expressions of a corpus or seed file; false if it cannot be read. */
+	bool read_expressions(string const& path, vector<string>& expressions) {
+		ifstream file(path);
+		if (!file)
+			return false;
+		for (string line; getline(file, line); ) {
+			while (!line.empty() && isspace(static_cast<unsigned char>(line.back())))
+				line.pop_back();
+			if (!line.empty() && line[0] != '#')
+				expressions.push_back(line);
+		}
+		return true;
+	}
+}
+
+
+
+MAKEAPP(ee_fuzz) {
+	auto const& args = get_args();
+	bool memoryObjective = false;
+	uint64_t iterations = 5000, seed = random_device()();
+	double seconds = 0;
+	size_t maxLength = 200, keep = 16;
+	EvaluationBudget::Limits limits;
+	limits.time = chrono::milliseconds(50);
+	limits.bits = uint64_t(1) << 24;
+	string corpusName = "fuzz_corpus.txt";
+	vector<string> seedNames;
+
+	for (size_t i = 1; i < args.size(); ++i) {
+		uint64_t n = 0;
+		if (args[i] == "--objective" && i + 1 < args.size() && (args[i + 1] == "time" || args[i + 1] == "memory"))
+			memoryObjective = args[++i] == "memory";
+		else if (args[i] == "--iterations" && i + 1 < args.size() && parse_number(args[i + 1], iterations))
+			++i;
+		else if (args[i] == "--time" && i + 1 < args.size() && parse_number(args[i + 1], seconds) && seconds >= 0)
+			++i;
+		else if (args[i] == "--budget" && i + 1 < args.size() && parse_number(args[i + 1], n) && n > 0) {
+			limits.time = chrono::milliseconds(n);
+			++i;
+		}
+		else if (args[i] == "--max-bits" && i + 1 < args.size() && parse_number(args[i + 1], limits.bits))
+			++i;
+		else if (args[i] == "--max-length" && i + 1 < args.size() && parse_number(args[i + 1], maxLength) && maxLength > 0)
+			++i;
+		else if (args[i] == "--keep" && i + 1 < args.size() && parse_number(args[i + 1], keep) && keep > 0)
+			++i;
+		else if (args[i] == "--seed" && i + 1 < args.size() && parse_number(args[i + 1], seed))
+			++i;
+		else if (args[i] == "-o" && i + 1 < args.size())
+			corpusName = args[++i];
+		else if (!args[i].empty() && args[i][0] != '-')
+			seedNames.push_back(args[i]);
+		else
+			return usage();
+	}
+
+	vector<string> seeds;
+	(void)read_expressions(corpusName, seeds);
+	for (auto const& name : seedNames)
+		if (!read_expressions(name, seeds)) {
+			cerr << "ee-fuzz: cannot open " << name << endl;
+			return EXIT_FAILURE;
+		}
+
+	Generator generator(seed);
+	vector<Entry> corpus;
+	vector<string> overBudget;
+	set<string> tried;
+	auto const score_of = [&](Entry const& e) {
+		return (memoryObjective ? e.cost.peakBytes : e.cost.nanoseconds) / static_cast<double>(e.expression.size());
+	};
+	auto const unit = memoryObjective ? " B/byte" : " ns/byte";
+
+	// Scores a candidate, adding it to the corpus if it is among the costliest; true if it is the new costliest.
+	auto const consider = [&](Entry entry) {
+		if (entry.expression.empty() || entry.expression.size() > maxLength || !tried.insert(entry.expression).second)
+			return false;
+		entry.cost = measure(entry.expression, limits);
+		if (entry.cost.overBudget) {
+			if (overBudget.size() < keep)
+				overBudget.push_back(entry.expression);
+			return false;
+		}
+		if (entry.cost.failed)
+			return false;
+		// the corpus keeps the costliest expression of each shape
+		entry.shape = shape(entry.expression);
+		auto const beaten = [&] {
+			auto const same = find_if(corpus.begin(), corpus.end(), [&](Entry const& e) { return e.shape == entry.shape; });
+			return same != corpus.end() ? entry.score <= same->score : corpus.size() >= keep && entry.score <= corpus.back().score;
+		};
+		entry.score = score_of(entry);
+		if (beaten())
+			return false;
+
+		// one run is noisy: a candidate for the corpus keeps the least of three
+		for (int run = 0; run < 2 && !memoryObjective; ++run)
+			entry.cost.nanoseconds = min(entry.cost.nanoseconds, measure(entry.expression, limits).nanoseconds);
+		entry.score = score_of(entry);
+		if (beaten())
+			return false;
+		corpus.erase(remove_if(corpus.begin(), corpus.end(), [&](Entry const& e) { return e.shape == entry.shape; }), corpus.end());
+		auto const position = upper_bound(corpus.begin(), corpus.end(), entry, [](Entry const& a, Entry const& b) { return a.score > b.score; });
+		bool const best = position == corpus.begin();
+		corpus.insert(position, move(entry));
+		if (corpus.size() > keep)
+			corpus.pop_back();
+		return best;
+	};
+
+	for (auto const& text : seeds) {
+		Entry entry;
+		entry.expression = text;
+		entry.tree.text = "(" + text + ")";		// a leaf that is never taken for a literal
+		entry.tree.type = measure(text, limits).type;
+		(void)consider(move(entry));
+	}
+
+	auto const start = clock_type::now();
+	uint64_t iteration = 0;
+	for (; iteration < iterations || seconds > 0; ++iteration) {
+		if (seconds > 0 && chrono::duration<double>(clock_type::now() - start).count() >= seconds)
+			break;
+		Entry candidate;
+		if (corpus.empty() || generator.chance(0.1))
+			candidate.tree = generator.generate(generator.any_type(), 3);
+		else {
+			// parents near the top of the corpus are chosen more often
+			auto const& parent = corpus[generator.below(generator.below(corpus.size()) + 1)];
+			candidate.tree = generator.mutate(parent.tree, corpus[generator.below(corpus.size())].tree);
+		}
+		candidate.expression = render(candidate.tree);
+		if (consider(move(candidate)))
+			cerr << "ee-fuzz: " << iteration << ": " << scientific << setprecision(3) << corpus.front().score << unit
+				<< "  " << corpus.front().expression << endl;
+	}
+
+	ofstream output(corpusName);
+	output << "# ee-fuzz corpus: objective " << (memoryObjective ? "memory" : "time") << ", budget "
+		<< chrono::duration_cast<chrono::milliseconds>(limits.time).count() << " ms, " << iteration << " iterations, seed " << seed << '\n';
+	for (auto const& entry : corpus)
+		output << "# " << scientific << setprecision(3) << entry.score << unit << ", " << fixed << setprecision(0)
+			<< entry.cost.nanoseconds << " ns, peak " << entry.cost.peakBytes << " B\n" << entry.expression << '\n';
+	for (auto const& expression : overBudget)
+		output << "# over budget: " << expression << '\n';
+	if (!output) {
+		cerr << "ee-fuzz: cannot write " << corpusName << endl;
+		return EXIT_FAILURE;
+	}
+	cerr << "ee-fuzz: " << corpus.size() << " expressions written to " << corpusName << ", " << overBudget.size() << " over budget" << endl;
+	return EXIT_SUCCESS;
+}
@@ -8,6 +8,20 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Added batch mode: --batch, --input, --output.
+	Added --pipeline: batch mode on a three-stage thread pipeline.
+	Added --mmap and --jobs: batch input from a memory-mapped file, optionally on worker threads.
+	Added --csv: evaluate one formula against every row of a CSV file.
+	Added --eecol, --result-type and --convert; --binary writes an EECOL file.
+	Added --serve: evaluation server on a Unix domain socket.
+	Added --expensive-jobs and --expensive-after: the server's expensive lane.
+	Added --time-limit, --max-bits and --max-operations (per row with --csv and --eecol).
+	Every mode defaults to the server's limits (10 s, 2^24-bit Integers).
+	Added the :stats and :stats reset commands.
+	Added --trace: a Chrome trace-event timeline of the run.
+	Added --slow-log and --slow-threshold: a log of slow expressions.
+
 Version 2021.11.01
 	C++ 20 validated
 
@@ -43,24 +57,360 @@ the program(s) have been supplied.
 ============================================================= */
 
 #include <gats/ConsoleApp.hpp>
+#include <ee/batch_io.hpp>
+#include <ee/batch_pipeline.hpp>
+#include <ee/csv_evaluator.hpp>
+#include <ee/eecol.hpp>
+#include <ee/eval_server.hpp>
 #include <ee/expression_evaluator.hpp>
+#include <ee/mapped_file.hpp>
+#include <ee/parallel_batch.hpp>
 #include <ee/function.hpp>
 #include <ee/real.hpp>
+#include <ee/slow_log.hpp>
+#include <ee/trace.hpp>
 
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <csignal>
+#include <cstdio>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <regex>
 #include <sstream>
+#include <vector>
 
 using namespace std;
 
 
 
+namespace {
+	/*!	Evaluates every line from 'source' (a FILE* or in-memory text), writing one line per
+		expression to 'output': the result, or 'Error: line <n>: <message>'.  Blank lines are
+		skipped.  Slow expressions are logged to 'slowLog', if any.  Returns the number of
+		failed expressions. */
+	template <typename Source>
+	size_t run_batch(Source source, FILE* output, EvaluationBudget::Limits const& limits, SlowLog* slowLog) {
+		ExpressionEvaluator evaluator;
+		evaluator.rpn_evaluator().budget().set_limits(limits);
+		BufferedWriter writer(output);
+		size_t lineNumber = 0, failures = 0;
+
+		for_each_line(source, [&](string_view line) {
+			++lineNumber;
+			if (all_of(line.begin(), line.end(), [](char c) { return isspace(static_cast<unsigned char>(c)) != 0; }))
+				return;
+			try {
+				writer.write((slowLog ? slowLog->evaluate(evaluator, line) : evaluator.evaluate(line))->str());
+				writer.write("\n");
+			}
+			catch (std::exception const& ex) {
+				++failures;
+				writer.write("Error: line " + to_string(lineNumber) + ": " + ex.what() + "\n");
+			}
+			catch (...) {
+				++failures;
+				writer.write("Error: line " + to_string(lineNumber) + ": unknown error\n");
+			}
+		});
+
+		writer.flush();
+		bool inputFailed = false;
+		if constexpr (is_same_v<Source, FILE*>)
+			inputFailed = ferror(source) != 0;
+		if (inputFailed || writer.failed()) {
+			cerr << "ee: I/O error in batch mode" << endl;
+			++failures;
+		}
+		return failures;
+	}
+
+	int usage() {
+		cerr << "usage: ee [--batch] [--pipeline] [--input file] [--output file]\n"
+				"       ee --mmap [--jobs n] --input file [--output file]\n"
+				"       ee (--csv | --eecol) file --expr formula [--column name] [--result-type type]\n"
+				"          [--output file | --binary file]\n"
+				"       ee --convert input output      (CSV to EECOL, or EECOL to CSV)\n"
+				"       ee --serve socket [--jobs n] [--expensive-jobs n] [--expensive-after microseconds]\n"
+				"limits, per expression or per --csv/--eecol row: [--time-limit ms] [--max-bits n] [--max-operations n]\n"
+				"          (default 10000 ms and 16777216 bits, as the server; 0 removes a limit)\n"
+				"any mode: [--trace file]      (Chrome trace-event JSON for chrome://tracing or ui.perfetto.dev)\n"
+				"interactive, --batch and --mmap without --jobs: [--slow-log file] [--slow-threshold ms]\n"
+				"interactive commands: :stats (timing and counters), :stats reset\n";
+		return EXIT_FAILURE;
+	}
+
+	EvalServer* server = nullptr;
+
+	extern "C" void stop_server(int) {
+		if (server)
+			server->stop();
+	}
+}
+
+
+
 
 MAKEAPP(ee) {
+    auto const& args = get_args();
+    bool batch = false, pipeline = false, mapped = false;
+    unsigned jobs = 0, expensiveJobs = 0;
+    double expensiveAfter = EvalServer::default_expensive_microseconds;
+    string inputName, outputName, csvName, formula, column = "result", convertFrom, convertTo, socketName, traceName, slowLogName;
+    auto format = CsvEvaluator::Format::csv;
+    bool eecolInput = false;
+    auto resultType = EecolType::float64;
+    int resultScale = 0;
+    EvaluationBudget::Limits limits = EvalServer::default_limits();
+    double slowThreshold = 100;
+    for (size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == "--batch")
+            batch = true;
+        else if (args[i] == "--pipeline")
+            batch = pipeline = true;
+        else if (args[i] == "--mmap")
+            batch = mapped = true;
+        else if (args[i] == "--jobs" && i + 1 < args.size()) {
+            auto const& n = args[++i];
+            if (from_chars(n.data(), n.data() + n.size(), jobs).ptr != n.data() + n.size() || jobs == 0)
+                return usage();
+        }
+        else if (args[i] == "--serve" && i + 1 < args.size())
+            socketName = args[++i];
+        else if (args[i] == "--expensive-jobs" && i + 1 < args.size()) {
+            auto const& n = args[++i];
+            if (from_chars(n.data(), n.data() + n.size(), expensiveJobs).ptr != n.data() + n.size() || expensiveJobs == 0)
+                return usage();
+        }
+        else if (args[i] == "--expensive-after" && i + 1 < args.size()) {
+            auto const& n = args[++i];
+            if (from_chars(n.data(), n.data() + n.size(), expensiveAfter).ptr != n.data() + n.size() || !(expensiveAfter >= 0))
+                return usage();
+        }
+        else if (args[i] == "--time-limit" && i + 1 < args.size()) {
+            auto const& n = args[++i];
+            std::uint64_t ms = 0;
+            if (from_chars(n.data(), n.data() + n.size(), ms).ptr != n.data() + n.size())
+                return usage();
+            limits.time = chrono::milliseconds(ms);
+        }
+        else if (args[i] == "--max-bits" && i + 1 < args.size()) {
+            auto const& n = args[++i];
+            if (from_chars(n.data(), n.data() + n.size(), limits.bits).ptr != n.data() + n.size())
+                return usage();
+        }
+        else if (args[i] == "--max-operations" && i + 1 < args.size()) {
+            auto const& n = args[++i];
+            if (from_chars(n.data(), n.data() + n.size(), limits.operations).ptr != n.data() + n.size())
+                return usage();
+        }
+        else if (args[i] == "--csv" && i + 1 < args.size())
+            csvName = args[++i];
+        else if (args[i] == "--expr" && i + 1 < args.size())
+            formula = args[++i];
+        else if (args[i] == "--column" && i + 1 < args.size())
+            column = args[++i];
+        else if (args[i] == "--eecol" && i + 1 < args.size())
+            csvName = args[++i], eecolInput = true;
+        else if (args[i] == "--binary" && i + 1 < args.size())
+            format = CsvEvaluator::Format::eecol, outputName = args[++i];
+        else if (args[i] == "--result-type" && i + 1 < args.size()) {
+            try {
+                resultType = parse_eecol_type(args[++i], resultScale);
+            }
+            catch (std::exception const&) {
+                return usage();
+            }
+        }
+        else if (args[i] == "--convert" && i + 2 < args.size())
+            convertFrom = args[i + 1], convertTo = args[i + 2], i += 2;
+        else if (args[i] == "--trace" && i + 1 < args.size())
+            traceName = args[++i];
+        else if (args[i] == "--slow-log" && i + 1 < args.size())
+            slowLogName = args[++i];
+        else if (args[i] == "--slow-threshold" && i + 1 < args.size()) {
+            auto const& n = args[++i];
+            if (from_chars(n.data(), n.data() + n.size(), slowThreshold).ptr != n.data() + n.size() || !(slowThreshold >= 0))
+                return usage();
+        }
+        else if (args[i] == "--input" && i + 1 < args.size())
+            batch = true, inputName = args[++i];
+        else if (args[i] == "--output" && i + 1 < args.size())
+            batch = true, outputName = args[++i];
+        else
+            return usage();
+    }
+
+    struct TraceStop {
+        ~TraceStop() { Tracer::stop(); }
+    } const traceStop;
+    if (!traceName.empty()) {
+        try {
+            Tracer::start(traceName);
+        }
+        catch (std::exception const& ex) {
+            cerr << ex.what() << endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!slowLogName.empty() && (pipeline || jobs != 0 || !socketName.empty() || !csvName.empty() || !convertFrom.empty()))
+        return usage();
+    unique_ptr<SlowLog> slowLog;
+    if (!slowLogName.empty()) {
+        try {
+            slowLog = make_unique<SlowLog>(slowLogName, chrono::duration_cast<chrono::nanoseconds>(chrono::duration<double, milli>(slowThreshold)));
+        }
+        catch (std::exception const& ex) {
+            cerr << ex.what() << endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!socketName.empty()) {
+        if (batch || mapped || !csvName.empty() || !convertFrom.empty())
+            return usage();
+        try {
+            EvalServer evalServer(socketName, jobs);
+            if (expensiveJobs != 0 || expensiveAfter != EvalServer::default_expensive_microseconds) {
+                auto const total = jobs != 0 ? jobs : evalServer.workers();
+                auto const expensive = expensiveJobs != 0 ? expensiveJobs : max(1u, total / 4);
+                evalServer.set_lanes(total > expensive ? total - expensive : 1, expensive, expensiveAfter);
+            }
+            evalServer.set_limits(limits);
+            server = &evalServer;
+            signal(SIGINT, stop_server);
+            signal(SIGTERM, stop_server);
+            cerr << "ee: serving on " << socketName << " with " << evalServer.workers() << " workers" << endl;
+            evalServer.run();
+            server = nullptr;
+            cerr << "ee: " << evalServer.connections() << " connections, " << evalServer.requests() << " requests" << endl;
+            for (auto lane : { EvalServer::Lane::cheap, EvalServer::Lane::expensive }) {
+                auto const stats = evalServer.lane_stats(lane);
+                cerr << "ee: " << (lane == EvalServer::Lane::cheap ? "cheap" : "expensive") << " lane, " << stats.workers << " workers: "
+                    << stats.requests << " requests, latency p50 " << stats.p50 << " us, p90 " << stats.p90
+                    << " us, p99 " << stats.p99 << " us, max " << stats.max << " us" << endl;
+            }
+            return EXIT_SUCCESS;
+        }
+        catch (std::exception const& ex) {
+            cerr << "ee: " << ex.what() << endl;
+            return EXIT_FAILURE;
+        }
+    }
+    if (jobs != 0)
+        batch = mapped = true;
+
+    if (mapped && (pipeline || inputName.empty()))
+        return usage();
+    if (csvName.empty() != formula.empty() || (!csvName.empty() && (pipeline || mapped || !inputName.empty())))
+        return usage();
+    if (format == CsvEvaluator::Format::eecol && csvName.empty())
+        return usage();
+
+    if (!convertFrom.empty()) {
+        try {
+            MappedFile input(convertFrom);
+            unique_ptr<FILE, int (*)(FILE*)> output(fopen(convertTo.c_str(), "wb"), fclose);
+            if (!output) {
+                cerr << "ee: cannot create " << convertTo << endl;
+                return EXIT_FAILURE;
+            }
+            if (EecolReader::is_eecol(input.contents()))
+                eecol_to_csv(EecolReader(input.contents()), output.get());
+            else
+                for (auto const& name : csv_to_eecol(input.contents(), output.get()))
+                    cerr << "ee: skipped non-numeric column '" << name << "'" << endl;
+            return EXIT_SUCCESS;
+        }
+        catch (std::exception const& ex) {
+            cerr << "ee: " << ex.what() << endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!csvName.empty()) {
+        unique_ptr<FILE, int (*)(FILE*)> outputFile(nullptr, fclose);
+        if (!outputName.empty()) {
+            outputFile.reset(fopen(outputName.c_str(), "wb"));
+            if (!outputFile) {
+                cerr << "ee: cannot create " << outputName << endl;
+                return EXIT_FAILURE;
+            }
+        }
+        try {
+            MappedFile file(csvName);
+            CsvEvaluator csv(formula);
+            csv.set_result_type(resultType, resultScale);
+            csv.set_limits(limits);
+            auto const output = outputFile ? outputFile.get() : stdout;
+            auto const failures = eecolInput
+                ? csv.run(EecolReader(file.contents()), output, format, column)
+                : csv.run(file.contents(), output, format, column);
+            return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+        catch (std::exception const& ex) {
+            cerr << "ee: " << ex.what() << endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (batch) {
+        unique_ptr<FILE, int (*)(FILE*)> inputFile(nullptr, fclose), outputFile(nullptr, fclose);
+        if (!inputName.empty() && !mapped) {
+            inputFile.reset(fopen(inputName.c_str(), "rb"));
+            if (!inputFile) {
+                cerr << "ee: cannot open " << inputName << endl;
+                return EXIT_FAILURE;
+            }
+        }
+        if (!outputName.empty()) {
+            outputFile.reset(fopen(outputName.c_str(), "wb"));
+            if (!outputFile) {
+                cerr << "ee: cannot create " << outputName << endl;
+                return EXIT_FAILURE;
+            }
+        }
+        auto const output = outputFile ? outputFile.get() : stdout;
+        if (mapped) {
+            try {
+                MappedFile file(inputName);
+                size_t failures;
+                if (jobs == 0)
+                    failures = run_batch(file.contents(), output, limits, slowLog.get());
+                else {
+                    ParallelBatch parallel(jobs);
+                    parallel.set_limits(limits);
+                    failures = parallel.run(file.contents(), output);
+                }
+                return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+            }
+            catch (std::exception const& ex) {
+                cerr << "ee: " << ex.what() << endl;
+                return EXIT_FAILURE;
+            }
+        }
+        auto const input = inputFile ? inputFile.get() : stdin;
+        size_t failures;
+        if (pipeline) {
+            BatchPipeline batchPipeline;
+            batchPipeline.evaluator().rpn_evaluator().budget().set_limits(limits);
+            failures = batchPipeline.run(input, output);
+        }
+        else
+            failures = run_batch(input, output, limits, slowLog.get());
+        return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
     cout << "Expression Evaluator, (c) 1998-2022 Garth Santor\n";
     ExpressionEvaluator evaluator;
+    evaluator.rpn_evaluator().budget().set_limits(limits);
     vector<Token::pointer_type> results;
 
     for (unsigned count = 1; ; ++count) {
@@ -69,8 +419,19 @@ MAKEAPP(ee) {
         if (!getline(cin, command) || command.empty())
             break;
 
+        if (command == ":stats") {
+            cout << evaluator.stats();
+            --count;
+            continue;
+        }
+        if (command == ":stats reset") {
+            evaluator.reset_stats();
+            --count;
+            continue;
+        }
+
         try {
-            auto result = evaluator.evaluate(command);
+            auto result = slowLog ? slowLog->evaluate(evaluator, command) : evaluator.evaluate(command);
             results.push_back(result);
 
             cout << "[" << count << "] = " << result->str() << endl;
@@ -16,6 +16,10 @@ ConsoleApp class declaration.
 =============================================================
 Revision History
 -------------------------------------------------------------
+Version 2026.10.18
+	setup() and wrapup() return normally; removed [[noreturn]].
+	Console state is only saved and restored on Windows.
+
 Version 2021.10.30
 	C++ 20 Version
 	Moved to namespace gats
@@ -91,9 +95,9 @@ namespace gats {
 		ConsoleApp(bool autoRestoreWindowStateOnExit = false);
 		virtual ~ConsoleApp();
 
-		[[noreturn]] virtual void setup() {}
+		virtual void setup() {}
 		[[nodiscard]] virtual int execute();
-		[[noreturn]] virtual void wrapup() {}
+		virtual void wrapup() {}
 
 		/*!	Access the command-line arguments container.
 		*/
@@ -111,6 +115,3 @@ namespace gats {
 		int execute() override;\
 } name##_g;\
 int name ::execute()
-
-
-#pragma endregion
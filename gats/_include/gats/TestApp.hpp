@@ -19,11 +19,38 @@ TestApp frame declarations.
 	GATS_CHECK_WITHIN()
 	GATS_CHECK_THROW()
 	GATS_FAIL()
+	TestApp::BenchCase class declaration.
+	GATS_BENCH()
+	GATS_BENCH_THRESHOLD()
+	TestApp::AllocationStats declaration.
+	GATS_TRACK_ALLOCATIONS()
+	GATS_CHECK_ALLOCS_AT_MOST()
+	GATS_CHECK_NO_ALLOCS()
+	GATS_CHECK_PEAK_BYTES_AT_MOST()
+	GATS_TEST_CASE_ISOLATED()
+	GATS_TEST_CASE_ISOLATED_WEIGHTED()
+	GATS_NOTE()
 
 =============================================================
 Revision History
 -------------------------------------------------------------
 
+2026-10-18
+	Added: GATS_NOTE, a line of the case's own (a measurement, say) in its report and log
+	record; GATS_TEST_CASE_ISOLATED_WEIGHTED.
+	Added: parallel runner.  With --jobs n the cases run on n threads (0: one per
+	hardware thread); each case's messages are buffered and reported in case order.
+	Cases flagged by GATS_TEST_CASE_ISOLATED, in the group isolatedGroup_csm, and
+	benchmarks run afterwards, one at a time.
+	Added: heap allocation tracking per case (GATS_TRACK_ALLOCATIONS) and the
+	GATS_CHECK_ALLOCS_AT_MOST, GATS_CHECK_NO_ALLOCS and GATS_CHECK_PEAK_BYTES_AT_MOST checks.
+	The global operator new and delete are replaced by counting versions (TestApp_alloc.cpp).
+	Added: benchmark cases (GATS_BENCH, GATS_BENCH_THRESHOLD) with a JSON baseline
+	and a regression threshold.  Command-line options:
+		--baseline file		the baseline (default gats-bench-baseline.json)
+		--save-baseline		writes this run's results to the baseline
+		--regression percent	the slowdown of the median that fails a case (default 10)
+
 2022-11-06
 	Changed: macro local variable names to guard against name masking.
 
@@ -95,6 +122,19 @@ namespace gats {
 		using ostringstream_type	= std::basic_ostringstream<char_type>;
 		using string_type			= std::basic_string<char_type>;
 
+		class BenchCase;
+
+		/*!	Heap use of the calling thread while a case tracks its allocations.
+			'liveBytes' can go negative when the case frees memory allocated
+			before tracking started. */
+		struct AllocationStats {
+			std::uintmax_t	allocations = 0;
+			std::uintmax_t	frees = 0;
+			std::uintmax_t	bytes = 0;			// allocated in total
+			std::intmax_t	liveBytes = 0;		// allocated less freed
+			std::uintmax_t	peakBytes = 0;		// the high-water mark of liveBytes
+		};
+
 		/*!	\brief class TestApp::TestCase
 			
 			TestCase is the base type of classes generated by GATS_TEST_CASE().
@@ -111,6 +151,13 @@ namespace gats {
 
 			double			weight_m = 1.0;			// weighted score of this case.
 
+			AllocationStats	allocations_m;
+			bool			allocationsTracked_m = false;
+
+			ostringstream_type	output_m;			// check failures, reported after the case runs
+			std::vector<string_type>	notes_m;	// GATS_NOTE lines
+			bool			isolated_m = false;		// runs alone, never beside another case
+
 		// VALUES
 			static const string_type	defaultGroup_csm;
 
@@ -134,13 +181,20 @@ namespace gats {
 			void output_check_location(ostream_type& _os, std::filesystem::path _file, int _line);
 			void check(bool _condition, char_type const * const _condStr, char const * const _file, int _line);
 			void check_message(bool _condition, string_type const& _message, char const * const _file, int _line);
+			void set_isolated() { isolated_m = true; }
+			void note(string_type const& _text) { notes_m.push_back(_text); }
+			[[nodiscard]] bool isolated() const;
+			void track_allocations();
+			void check_allocs_at_most(std::uintmax_t _maximum, char_type const* _maximumStr, char const* const _file, int _line);
+			void check_peak_bytes_at_most(std::uintmax_t _maximum, char_type const* _maximumStr, char const* const _file, int _line);
+			[[nodiscard]] AllocationStats const& allocations() const { return allocations_m; }
 			template <typename LHS, typename RHS> 
 			void check_equal(LHS const& _lhs, RHS const& _rhs, char_type const* _lhsStr, char_type const* _rhsStr, char const* const _file, int _line);
 			template <typename LHS, typename RHS, typename VALUE>
 			void check_close_within(LHS const& _lhs, RHS const& _rhs, VALUE const& _minimum, char_type const* _lhsStr, char_type const* _rhsStr, char_type const* _minimumStr, char const* const _file, int _line);
 
 			// Parent Services
-			inline ostream_type& display() { return TestApp::display(); }
+			inline ostream_type& display() { return output_m; }
 			inline ostream_type& log() { return TestApp::logFile_m; }
 
 			constexpr auto operator <=> (TestCase const& rhs) const { return name_m <=> rhs.name_m; }
@@ -148,8 +202,49 @@ namespace gats {
 
 			// Access
 			friend class TestApp;
+			friend class BenchCase;
 		};
 
+
+
+		/*!	\brief class TestApp::BenchCase
+
+			BenchCase is the base type of classes generated by GATS_BENCH().
+			execute() runs the body a tenth of 'iterations' times (at least once)
+			to warm up, then 'iterations' times, timing each run.  It reports the
+			median, p90 and p99, and fails when the median is slower than the
+			baseline's by more than the regression threshold.  A case with no
+			baseline passes.  Each timed run includes two clock reads, so the body
+			should do at least a microsecond of work. */
+		class BenchCase : public TestCase {
+		// ATTRIBUTES
+			std::uintmax_t				iterations_m;
+			double						regressionPercent_m;	// negative: the command-line threshold
+			char const*					file_m;
+			int							line_m;
+			std::chrono::nanoseconds	median_m{}, p90_m{}, p99_m{};
+			bool						measured_m = false;
+
+		// VALUES
+			static constexpr char_type	benchGroup_csm[] = "Benchmarks";	// a literal: cases register during static initialization
+
+		// OPERATIONS
+		public:
+			BenchCase(string_type const& name, std::uintmax_t iterations, double regressionPercent, char const* file, int line);
+
+			// Application Interface
+			virtual void run() = 0;
+
+			void execute() override;
+
+			// Access
+			friend class TestApp;
+		};
+
+		/*!	Cases in this group run alone, as if flagged by GATS_TEST_CASE_ISOLATED():
+			GATS_TEST_CASE(name, gats::TestApp::isolatedGroup_csm) */
+		static constexpr char_type	isolatedGroup_csm[] = "Isolated";
+
 	// ATTRIBUTES
 	private:
 		using case_pointer_type = TestCase*;								/// will point to statically allocated test cases.
@@ -159,11 +254,28 @@ namespace gats {
 
 		static case_groups_pointer_type	casesPtr_sm;
 		static ofstream_type			logFile_m;
-		static case_pointer_type		currentCasePtr_sm;
+		static thread_local case_pointer_type	currentCasePtr_sm;
+		static unsigned					jobs_sm;			// threads for the parallel cases
+
+		/*!	Median, p90 and p99 of a benchmark, in nanoseconds. */
+		struct BenchResult {
+			double	median = 0, p90 = 0, p99 = 0;
+		};
+		using bench_results_type = std::map<string_type, BenchResult>;
+
+		static std::filesystem::path	baselinePath_sm;
+		static bench_results_type		baseline_sm;
+		static bool						saveBaseline_sm;
+		static double					regressionPercent_sm;
+		static std::uintmax_t			nRegressions_sm;
 
 	// OPERATIONS
 		static ostream_type&		display() { return std::cout; }
 		static case_groups_type&	cases();
+		static void					run_case(case_pointer_type testCase);
+		static void					run_cases(case_list_type const& testCases, unsigned jobs);
+		static void					load_baseline();
+		static void					save_baseline();
 
 		// Interface
 		void setup() override;
@@ -171,6 +283,10 @@ namespace gats {
 
 	public:
 		static case_pointer_type current_case(char const* file, int line);
+
+		/*!	Counts the calling thread's allocations and frees into 'stats'; nullptr stops
+			counting.  Implemented with the operator new replacements in TestApp_alloc.cpp. */
+		static void count_allocations(AllocationStats* stats);
 	};
 
 
@@ -259,6 +375,33 @@ namespace gats {
 	void TestCase_ ## MACRO_PARAM_GTCP_name :: execute()
 
 
+/*!	Creates a test case with the identifier 'name' that runs alone, after the parallel cases.
+
+	\param 'name' is the test cases identifier.
+
+	For cases that use process-wide state (the console, the working directory, timing).
+*/
+#define GATS_TEST_CASE_ISOLATED(MACRO_PARAM_GTCI_name) \
+	static class TestCase_ ## MACRO_PARAM_GTCI_name : public gats::TestApp::TestCase {\
+	public: TestCase_ ## MACRO_PARAM_GTCI_name() : TestCase(#MACRO_PARAM_GTCI_name, 1.0) { set_isolated(); }\
+	public: virtual void execute() override;\
+	} TestCase_ ## MACRO_PARAM_GTCI_name ## _g;\
+	void TestCase_ ## MACRO_PARAM_GTCI_name :: execute()
+
+
+/*!	Creates a weighted test case with the identifier 'name' that runs alone, after the parallel cases.
+
+	\param 'name' is the test cases identifier.
+	\param 'weight' is the weight of the case's score.
+*/
+#define GATS_TEST_CASE_ISOLATED_WEIGHTED(MACRO_PARAM_GTCIW_name,MACRO_PARAM_GTCIW_weight) \
+	static class TestCase_ ## MACRO_PARAM_GTCIW_name : public gats::TestApp::TestCase {\
+	public: TestCase_ ## MACRO_PARAM_GTCIW_name() : TestCase(#MACRO_PARAM_GTCIW_name,(MACRO_PARAM_GTCIW_weight)) { set_isolated(); }\
+	public: virtual void execute() override;\
+	} TestCase_ ## MACRO_PARAM_GTCIW_name ## _g;\
+	void TestCase_ ## MACRO_PARAM_GTCIW_name :: execute()
+
+
 /*!	Performs a check point for the specified condition.
 
 	\param 'cond' is condition that must pass.
@@ -353,3 +496,73 @@ namespace gats {
 	return;\
 }
 #define GATS_FAIL(MACRO_PARAM_GF_msg) DETAIL_GATS_FAIL(MACRO_PARAM_GF_msg, __FILE__, __LINE__)
+
+
+
+/*!	Adds a line to the test case's report and log record.
+
+	\param 'msg' is streamed, as the message of GATS_CHECK_MESSAGE():  GATS_NOTE(rate << " per second")
+*/
+#define GATS_NOTE(MACRO_PARAM_GN_msg) {\
+	gats::TestApp::ostringstream_type MACRO_LOCAL_GN_oss;\
+	MACRO_LOCAL_GN_oss << MACRO_PARAM_GN_msg;\
+	gats::TestApp::current_case(__FILE__,__LINE__)->note(MACRO_LOCAL_GN_oss.str());\
+}
+
+
+
+/*!	Starts (or restarts) counting the test case's heap allocations, on the calling thread,
+	until the end of the case.
+*/
+#define GATS_TRACK_ALLOCATIONS() gats::TestApp::current_case(__FILE__,__LINE__)->track_allocations()
+
+
+/*!	Checks that the test case has made at most 'maximum' allocations since GATS_TRACK_ALLOCATIONS().
+
+	\param 'maximum' is the number of allocations allowed.
+*/
+#define GATS_CHECK_ALLOCS_AT_MOST(MACRO_PARAM_GCAAM_maximum)\
+	gats::TestApp::current_case(__FILE__,__LINE__)->check_allocs_at_most((MACRO_PARAM_GCAAM_maximum), #MACRO_PARAM_GCAAM_maximum, __FILE__, __LINE__)
+
+
+/*!	Checks that the test case has made no allocations since GATS_TRACK_ALLOCATIONS(). */
+#define GATS_CHECK_NO_ALLOCS()\
+	gats::TestApp::current_case(__FILE__,__LINE__)->check_allocs_at_most(0, "0", __FILE__, __LINE__)
+
+
+/*!	Checks that the test case's live heap bytes have not risen by more than 'maximum' since GATS_TRACK_ALLOCATIONS().
+
+	\param 'maximum' is the peak number of bytes allowed.
+*/
+#define GATS_CHECK_PEAK_BYTES_AT_MOST(MACRO_PARAM_GCPBAM_maximum)\
+	gats::TestApp::current_case(__FILE__,__LINE__)->check_peak_bytes_at_most((MACRO_PARAM_GCPBAM_maximum), #MACRO_PARAM_GCPBAM_maximum, __FILE__, __LINE__)
+
+
+
+/*!	Creates a benchmark case with the identifier 'name', whose body is run 'iterations' times.
+
+	\param 'name' is the benchmark's identifier, and its key in the baseline file.
+	\param 'iterations' is the number of timed runs.
+
+	The case fails if its median time regresses beyond the command-line threshold.
+*/
+#define GATS_BENCH(MACRO_PARAM_GB_name, MACRO_PARAM_GB_iterations) \
+	static class BenchCase_ ## MACRO_PARAM_GB_name : public gats::TestApp::BenchCase {\
+	public: BenchCase_ ## MACRO_PARAM_GB_name() : BenchCase(#MACRO_PARAM_GB_name, (MACRO_PARAM_GB_iterations), -1.0, __FILE__, __LINE__) { }\
+	public: virtual void run() override;\
+	} BenchCase_ ## MACRO_PARAM_GB_name ## _g;\
+	void BenchCase_ ## MACRO_PARAM_GB_name :: run()
+
+
+/*!	Creates a benchmark case with its own regression threshold.
+
+	\param 'name' is the benchmark's identifier, and its key in the baseline file.
+	\param 'iterations' is the number of timed runs.
+	\param 'percent' is the slowdown of the median, over the baseline, that fails the case.
+*/
+#define GATS_BENCH_THRESHOLD(MACRO_PARAM_GBT_name, MACRO_PARAM_GBT_iterations, MACRO_PARAM_GBT_percent) \
+	static class BenchCase_ ## MACRO_PARAM_GBT_name : public gats::TestApp::BenchCase {\
+	public: BenchCase_ ## MACRO_PARAM_GBT_name() : BenchCase(#MACRO_PARAM_GBT_name, (MACRO_PARAM_GBT_iterations), (MACRO_PARAM_GBT_percent), __FILE__, __LINE__) { }\
+	public: virtual void run() override;\
+	} BenchCase_ ## MACRO_PARAM_GBT_name ## _g;\
+	void BenchCase_ ## MACRO_PARAM_GBT_name :: run()
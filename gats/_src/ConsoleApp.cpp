@@ -15,6 +15,9 @@ ConsoleApp class declaration.
 =========================================================================
 Revision History
 -------------------------------------------------------------
+Version 2026.10.18
+	Console state save/restore is Windows-only, matching the header.
+
 Version 2021.10.30
 	C++ 20 Version
 	Moved to namespace gats
@@ -120,8 +123,10 @@ namespace gats {
 		thisApp_sm->args_m.assign(argv, argv + argc);
 
 		// Save the console state
+#if defined(_WIN32)
 		if (thisApp_sm->autoRestoreWindowStateOnExit_m)
 			thisApp_sm->initialState_m = thisApp_sm->console.GetState();
+#endif
 
 		// Reconfigure the console
 		thisApp_sm->setup();
@@ -158,8 +163,10 @@ namespace gats {
 			this->wrapup();
 
 		// Restore the console state
+#if defined(_WIN32)
 		if (autoRestoreWindowStateOnExit_m)
 			console.SetState(initialState_m);
+#endif
 	}
 
 
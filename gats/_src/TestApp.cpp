@@ -17,11 +17,24 @@ TestApp framework implementations.
 	GATS_CHECK_EQUAL()
 	GATS_CHECK_WITHIN()
 	GATS_CHECK_THROW()
+	TestApp::TestCase allocation checks.
+	TestApp::BenchCase implementation.
+	Benchmark baseline file.
+	TestApp::TestCase::isolated()
 
 =========================================================================
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Added:
+		TestApp::TestCase::track_allocations(), check_allocs_at_most(), check_peak_bytes_at_most()
+		TestApp::BenchCase
+		benchmark baseline loading and saving
+		--baseline, --save-baseline and --regression options
+		TestApp::TestCase::isolated(), --jobs option
+	Changed: the current case is per thread, so cases can run in parallel.
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -57,13 +70,17 @@ the program(s) have been supplied.
 
 
 #include <gats/TestApp.hpp>
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <functional>
 #include <filesystem>
+#include <regex>
 #include <string>
+#include <thread>
 
 
 namespace gats {
@@ -116,6 +133,106 @@ namespace gats {
 
 
 
+	/*!	True if the case must run alone: flagged, or in the isolated group. */
+	bool TestApp::TestCase::isolated() const {
+		return isolated_m || group_m == isolatedGroup_csm;
+	}
+
+
+
+	/*!	Starts counting this case's allocations on the calling thread, from zero. */
+	void TestApp::TestCase::track_allocations() {
+		allocations_m = AllocationStats{};
+		allocationsTracked_m = true;
+		TestApp::count_allocations(&allocations_m);
+	}
+
+
+
+	/*!	Checks the allocations counted since track_allocations(), reporting if there are more than 'maximum'. */
+	void TestApp::TestCase::check_allocs_at_most(std::uintmax_t maximum, char_type const* maximumStr, char const* const file, int line) {
+		if (allocationsTracked_m && allocations_m.allocations <= maximum) {	// no message to build: the check itself must not allocate
+			add_check();
+			add_passed();
+			return;
+		}
+		ostringstream_type oss;
+		if (!allocationsTracked_m)
+			oss << "allocations checked without GATS_TRACK_ALLOCATIONS()";
+		else
+			oss << allocations_m.allocations << " allocations, expecting at most " << maximumStr << " [" << maximum << "]";
+		check_message(false, oss.str(), file, line);
+	}
+
+
+
+	/*!	Checks the peak live bytes since track_allocations(), reporting if the peak is over 'maximum'. */
+	void TestApp::TestCase::check_peak_bytes_at_most(std::uintmax_t maximum, char_type const* maximumStr, char const* const file, int line) {
+		if (allocationsTracked_m && allocations_m.peakBytes <= maximum) {	// no message to build: the check itself must not allocate
+			add_check();
+			add_passed();
+			return;
+		}
+		ostringstream_type oss;
+		if (!allocationsTracked_m)
+			oss << "peak bytes checked without GATS_TRACK_ALLOCATIONS()";
+		else
+			oss << "peak of " << allocations_m.peakBytes << " bytes, expecting at most " << maximumStr << " [" << maximum << "]";
+		check_message(false, oss.str(), file, line);
+	}
+
+
+
+// ----------------------------------------------------------------------------
+// TestApp::BenchCase
+// ----------------------------------------------------------------------------
+
+	/*!	BenchCase constructor registers the benchmark with the TestApp, in its own group. */
+	TestApp::BenchCase::BenchCase(string_type const& name, std::uintmax_t iterations, double regressionPercent, char const* file, int line)
+		: TestCase(name, benchGroup_csm), iterations_m(iterations == 0 ? 1 : iterations), regressionPercent_m(regressionPercent), file_m(file), line_m(line) {
+		set_isolated();		// timings taken beside other cases would be meaningless
+	}
+
+
+
+	/*!	Warms up, times the runs of the body, and checks the median against the baseline. */
+	void TestApp::BenchCase::execute() {
+		using clock = std::chrono::steady_clock;
+		for (auto i = std::max<std::uintmax_t>(iterations_m / 10, 1); i != 0; --i)
+			run();
+
+		std::vector<std::chrono::nanoseconds> times(iterations_m);
+		for (auto& time : times) {
+			auto const start = clock::now();
+			run();
+			time = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+		}
+		std::sort(times.begin(), times.end());
+		auto const rank = [&](double fraction) { return times[static_cast<std::size_t>(std::ceil(fraction * times.size())) - 1]; };
+		median_m = rank(0.5);
+		p90_m = rank(0.9);
+		p99_m = rank(0.99);
+		measured_m = true;
+
+		auto const baseline = baseline_sm.find(name_m);
+		if (baseline == baseline_sm.end() || baseline->second.median <= 0) {
+			add_check();
+			add_passed();
+			return;
+		}
+		auto const percent = regressionPercent_m >= 0 ? regressionPercent_m : regressionPercent_sm;
+		auto const limit = baseline->second.median * (1.0 + percent / 100.0);
+		bool const regressed = static_cast<double>(median_m.count()) > limit;
+		ostringstream_type oss;
+		oss << std::fixed << std::setprecision(1) << "median " << median_m.count() << " ns is "
+			<< (static_cast<double>(median_m.count()) / baseline->second.median - 1.0) * 100.0 << "% over the baseline "
+			<< baseline->second.median << " ns (threshold " << percent << "%)";
+		check_message(!regressed, oss.str(), file_m, line_m);
+		nRegressions_sm += regressed;
+	}
+
+
+
 // ----------------------------------------------------------------------------
 // TestApp
 // ----------------------------------------------------------------------------
@@ -123,8 +240,14 @@ namespace gats {
 	//! Classifier instances for TestApp
 	TestApp::case_groups_pointer_type	TestApp::casesPtr_sm;
 	TestApp::ofstream_type				TestApp::logFile_m;
-	TestApp::case_pointer_type			TestApp::currentCasePtr_sm = nullptr;
+	thread_local TestApp::case_pointer_type	TestApp::currentCasePtr_sm = nullptr;
+	unsigned							TestApp::jobs_sm = 1;
 	TestApp::string_type const			TestApp::TestCase::defaultGroup_csm{};
+	std::filesystem::path				TestApp::baselinePath_sm{ "gats-bench-baseline.json" };
+	TestApp::bench_results_type			TestApp::baseline_sm;
+	bool								TestApp::saveBaseline_sm = false;
+	double								TestApp::regressionPercent_sm = 10.0;
+	std::uintmax_t						TestApp::nRegressions_sm = 0;
 
 
 	//! Global TestConsoleApp instance <<singleton>>
@@ -151,7 +274,51 @@ namespace gats {
 	}
 
 
-	/*!	'setup' overrides the application method to register a logfile for storing test results. */
+	/*!	Reads the benchmark baseline, if there is one.  Each benchmark is a member of the
+		top-level object: "name": { "median_ns": 1234.0, "p90_ns": 1500.0, "p99_ns": 2100.0 } */
+	void TestApp::load_baseline() {
+		std::ifstream file(baselinePath_sm);
+		if (!file)
+			return;
+		std::string const text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		std::regex const entry(R"re("([^"]+)"\s*:\s*\{([^}]*)\})re");
+		auto const field = [](std::string const& members, char const* name) {
+			std::smatch match;
+			if (std::regex_search(members, match, std::regex(std::string("\"") + name + R"re("\s*:\s*([0-9.eE+-]+))re")))
+				return std::stod(match[1]);
+			return 0.0;
+		};
+		for (std::sregex_iterator it(text.begin(), text.end(), entry), end; it != end; ++it) {
+			auto const members = (*it)[2].str();
+			baseline_sm[(*it)[1].str()] = { field(members, "median_ns"), field(members, "p90_ns"), field(members, "p99_ns") };
+		}
+	}
+
+
+
+	/*!	Writes the baseline with this run's results, keeping the entries of benchmarks that did not run. */
+	void TestApp::save_baseline() {
+		for (auto const& testCaseGroup : cases())
+			for (auto const& testCase : testCaseGroup.second)
+				if (auto const bench = dynamic_cast<BenchCase const*>(testCase); bench && bench->measured_m)
+					baseline_sm[bench->name_m] = { double(bench->median_m.count()), double(bench->p90_m.count()), double(bench->p99_m.count()) };
+
+		std::ofstream file(baselinePath_sm);
+		if (!file)
+			throw std::runtime_error("Could not write: " + baselinePath_sm.string());
+		file << "{" << std::fixed << std::setprecision(1);
+		char const* separator = "\n";
+		for (auto const& [name, result] : baseline_sm) {
+			file << separator << "\t\"" << name << "\": { \"median_ns\": " << result.median << ", \"p90_ns\": " << result.p90 << ", \"p99_ns\": " << result.p99 << " }";
+			separator = ",\n";
+		}
+		file << "\n}\n";
+	}
+
+
+
+	/*!	'setup' overrides the application method to register a logfile for storing test results,
+		and to read the benchmark options and baseline. */
 	void TestApp::setup() {
 		using namespace std;
 		std::filesystem::path filename = "gats-test-log-file.txt";
@@ -159,6 +326,24 @@ namespace gats {
 		if (!logFile_m) {
 			throw std::runtime_error("Could not open: "s + filename.string());
 		}
+
+		auto const& args = get_args();
+		for (size_t i = 1; i < args.size(); ++i) {
+			if (args[i] == "--baseline" && i + 1 < args.size())
+				baselinePath_sm = args[++i];
+			else if (args[i] == "--save-baseline")
+				saveBaseline_sm = true;
+			else if (args[i] == "--regression" && i + 1 < args.size())
+				regressionPercent_sm = std::stod(args[++i]);
+			else if (args[i] == "--jobs" && i + 1 < args.size()) {
+				jobs_sm = static_cast<unsigned>(std::stoul(args[++i]));
+				if (jobs_sm == 0)
+					jobs_sm = std::max(std::thread::hardware_concurrency(), 1u);
+			}
+			else
+				throw std::runtime_error("usage: [--jobs n] [--baseline file] [--save-baseline] [--regression percent]");
+		}
+		load_baseline();
 	}
 
 } // end-of-namespace gats
\ No newline at end of file
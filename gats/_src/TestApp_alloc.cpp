@@ -0,0 +1,150 @@
+/*!	\file	TestApp_alloc.cpp
+	\brief	TestApp heap allocation counting.
+	\author	Garth Santor
+	\date	2026-10-18
+	\copyright	Garth Santor, Trinh Han
+
+=========================================================================
+Replaces the global operator new and delete (every form the standard
+lets a program replace) with versions that forward to malloc/free and,
+while a test case tracks its allocations, count them.
+
+Each block carries a header holding its size, so a free can be
+charged against the live bytes even when the matching delete is not
+the sized form.  The counts go to the AllocationStats of the case
+being run on the calling thread; memory allocated on other threads is
+not counted.
+
+=========================================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Alpha release.
+
+=========================================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=========================================================================*/
+
+
+#include <gats/TestApp.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+
+
+namespace {
+	thread_local gats::TestApp::AllocationStats* counting_s = nullptr;
+
+	constexpr std::size_t default_alignment = alignof(std::max_align_t);
+
+	// The header sits just before the block, in a prefix one alignment unit long.
+	std::size_t prefix(std::size_t alignment) {
+		return std::max(alignment, default_alignment);
+	}
+
+	[[nodiscard]] void* counted_alloc(std::size_t size, std::size_t alignment) noexcept {
+		auto const offset = prefix(alignment);
+		if (size > SIZE_MAX - offset)
+			return nullptr;
+#if defined(_WIN32)
+		auto const base = static_cast<char*>(alignment > default_alignment ? _aligned_malloc(size + offset, alignment) : std::malloc(size + offset));
+#else
+		void* memory = nullptr;
+		if (alignment > default_alignment) {
+			if (posix_memalign(&memory, alignment, size + offset) != 0)
+				memory = nullptr;
+		}
+		else
+			memory = std::malloc(size + offset);
+		auto const base = static_cast<char*>(memory);
+#endif
+		if (!base)
+			return nullptr;
+		auto const block = base + offset;
+		reinterpret_cast<std::size_t*>(block)[-1] = size;
+
+		if (auto const stats = counting_s) {
+			++stats->allocations;
+			stats->bytes += size;
+			stats->liveBytes += static_cast<std::intmax_t>(size);
+			if (stats->liveBytes > 0)
+				stats->peakBytes = std::max(stats->peakBytes, static_cast<std::uintmax_t>(stats->liveBytes));
+		}
+		return block;
+	}
+
+	void counted_free(void* p, std::size_t alignment) noexcept {
+		if (!p)
+			return;
+		auto const block = static_cast<char*>(p);
+		if (auto const stats = counting_s) {
+			++stats->frees;
+			stats->liveBytes -= static_cast<std::intmax_t>(reinterpret_cast<std::size_t*>(block)[-1]);
+		}
+		auto const base = block - prefix(alignment);
+#if defined(_WIN32)
+		if (alignment > default_alignment) {
+			_aligned_free(base);
+			return;
+		}
+#endif
+		std::free(base);
+	}
+
+	[[nodiscard]] void* throwing_alloc(std::size_t size, std::size_t alignment) {
+		for (;;) {
+			if (void* p = counted_alloc(size, alignment))
+				return p;
+			auto const handler = std::get_new_handler();
+			if (!handler)
+				throw std::bad_alloc();
+			handler();
+		}
+	}
+}
+
+
+
+namespace gats {
+	/*!	Directs the calling thread's allocation counts to 'stats', or nowhere for nullptr. */
+	void TestApp::count_allocations(AllocationStats* stats) {
+		counting_s = stats;
+	}
+} // end-of-namespace gats
+
+
+
+void* operator new(std::size_t size) { return throwing_alloc(size, default_alignment); }
+void* operator new[](std::size_t size) { return throwing_alloc(size, default_alignment); }
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept { return counted_alloc(size, default_alignment); }
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept { return counted_alloc(size, default_alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return throwing_alloc(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return throwing_alloc(size, static_cast<std::size_t>(alignment)); }
+void* operator new(std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept { return counted_alloc(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept { return counted_alloc(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void* p) noexcept { counted_free(p, default_alignment); }
+void operator delete[](void* p) noexcept { counted_free(p, default_alignment); }
+void operator delete(void* p, std::size_t) noexcept { counted_free(p, default_alignment); }
+void operator delete[](void* p, std::size_t) noexcept { counted_free(p, default_alignment); }
+void operator delete(void* p, std::nothrow_t const&) noexcept { counted_free(p, default_alignment); }
+void operator delete[](void* p, std::nothrow_t const&) noexcept { counted_free(p, default_alignment); }
+void operator delete(void* p, std::align_val_t alignment) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* p, std::align_val_t alignment) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete(void* p, std::size_t, std::align_val_t alignment) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* p, std::size_t, std::align_val_t alignment) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete(void* p, std::align_val_t alignment, std::nothrow_t const&) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* p, std::align_val_t alignment, std::nothrow_t const&) noexcept { counted_free(p, static_cast<std::size_t>(alignment)); }
@@ -22,6 +22,16 @@ TestApp framework implementations.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Added:
+		parallel runner (--jobs): isolated cases run afterwards, one at a time, and
+		each case's messages are reported in case order
+		GATS_NOTE lines after the case's result line
+		allocation report lines for cases that track their allocations
+		benchmark report lines: median, p90, p99 and the baseline
+		--save-baseline writes the baseline after the run
+		failure exit status when a benchmark regresses
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -57,7 +67,10 @@ the program(s) have been supplied.
 
 
 #include <gats/TestApp.hpp>
+#include <atomic>
 #include <chrono>
+#include <thread>
+#include <vector>
 using namespace std;
 using namespace std::chrono;
 using namespace gats::win32;
@@ -65,6 +78,43 @@ using namespace gats::win32;
 
 
 namespace gats {
+	/*!	Runs one case on the calling thread, timing it and trapping its exceptions. */
+	void TestApp::run_case(case_pointer_type testCase) {
+		currentCasePtr_sm = testCase;
+		auto start = high_resolution_clock::now();
+		try {
+			testCase->execute();
+		}
+		catch (...) {
+			testCase->output_m << testCase->name_m << ": Unknown exception caught." << endl;
+		}
+		count_allocations(nullptr);
+		testCase->elapsedTime_m = high_resolution_clock::now() - start;
+		currentCasePtr_sm = nullptr;
+	}
+
+
+
+	/*!	Runs 'testCases' on 'jobs' threads, the calling thread among them.  Each thread
+		takes the next case not yet started until none are left. */
+	void TestApp::run_cases(case_list_type const& testCases, unsigned jobs) {
+		std::atomic<std::size_t> next{ 0 };
+		auto worker = [&] {
+			for (std::size_t i; (i = next++) < testCases.size(); )
+				run_case(testCases[i]);
+		};
+
+		jobs = static_cast<unsigned>(std::min<std::size_t>(std::max(jobs, 1u), std::max<std::size_t>(testCases.size(), 1)));
+		std::vector<std::thread> threads;
+		for (unsigned i = 1; i < jobs; ++i)
+			threads.emplace_back(worker);
+		worker();
+		for (auto& thread : threads)
+			thread.join();
+	}
+
+
+
 	/*!	'execute' overrides the application interface method to perform all test cases and log/report the results. */
 	int TestApp::execute() {
 
@@ -87,6 +137,23 @@ namespace gats {
 
 
 
+		// benchmark time format
+		auto formatTime = [](double ns) {
+			ostringstream_type oss;
+			oss << std::fixed << std::setprecision(2);
+			if (ns >= 1e9)
+				oss << ns / 1e9 << " s";
+			else if (ns >= 1e6)
+				oss << ns / 1e6 << " ms";
+			else if (ns >= 1e3)
+				oss << ns / 1e3 << " us";
+			else
+				oss << ns << " ns";
+			return oss.str();
+		};
+
+
+
 		// restore console attributes on exit
 		ScopedAttributeState sas;
 
@@ -106,35 +173,21 @@ namespace gats {
 
 
 
-		// Run the cases
+		// Run the cases: the independent ones in parallel, then the isolated ones alone
+		case_list_type parallelCases, isolatedCases;
+		for (auto& testCaseGroup : cases())
+			for (auto& testCase : testCaseGroup.second)
+				(testCase->isolated() ? isolatedCases : parallelCases).push_back(testCase);
+		run_cases(parallelCases, jobs_sm);
+		for (auto& testCase : isolatedCases)
+			run_case(testCase);
+
+		// Report the messages of the cases, in case order
 		for (auto& testCaseGroup : cases()) {
 			for (auto& testCase : testCaseGroup.second) {
-				cout << bright(yellow);
-				currentCasePtr_sm = testCase;
-				bool ranWithoutException = false;
-				string exceptionMessage;
-				auto start = high_resolution_clock::now();
-				try {
-					testCase->execute();
-					ranWithoutException = true;
-
-					nMaxChecked = std::max(nMaxChecked, testCase->nChecked_m);
-				}
-				catch (...) {
-					exceptionMessage = "Unknown exception caught.";
-				};
-				auto stop = high_resolution_clock::now();
-				auto elapsedTime = stop - start;
-				testCase->elapsedTime_m = elapsedTime;
-
-				// report exception trapped
-				if (!ranWithoutException) {
-					cout << testCase->name_m << ": ";
-					cout << exceptionMessage << endl;
-				}
-
-				currentCasePtr_sm = nullptr;
-				cout << white;
+				nMaxChecked = std::max(nMaxChecked, testCase->nChecked_m);
+				if (auto const messages = testCase->output_m.str(); !messages.empty())
+					cout << bright(yellow) << messages << white;
 			}
 		}
 		auto nMaxCheckedDigits = (std::streamsize)floor(log10(nMaxChecked)) + 1;
@@ -207,6 +260,31 @@ namespace gats {
 				cout << " " << testCase->name_m;
 				cout << endl;
 
+				// notes
+				for (auto const& note : testCase->notes_m) {
+					cout << white << "        " << note << endl;
+					logFile_m << "\t\t" << note << std::endl;
+				}
+
+				// allocation counts
+				if (testCase->allocationsTracked_m) {
+					auto const& allocations = testCase->allocations_m;
+					cout << white << "        allocations " << allocations.allocations << ", frees " << allocations.frees
+						<< ", " << allocations.bytes << " bytes, peak " << allocations.peakBytes << " bytes" << endl;
+					logFile_m << "\t\t" << allocations.allocations << "\t" << allocations.frees << "\t" << allocations.peakBytes << " bytes" << std::endl;
+				}
+
+				// benchmark results
+				if (auto const bench = dynamic_cast<BenchCase const*>(testCase); bench && bench->measured_m) {
+					cout << white << "        median " << formatTime(double(bench->median_m.count()))
+						<< ", p90 " << formatTime(double(bench->p90_m.count()))
+						<< ", p99 " << formatTime(double(bench->p99_m.count()));
+					if (auto const baseline = baseline_sm.find(testCase->name_m); baseline != baseline_sm.end())
+						cout << ", baseline " << formatTime(baseline->second.median);
+					cout << " (" << bench->iterations_m << " runs)" << endl;
+					logFile_m << "\t\t" << bench->median_m.count() << "\t" << bench->p90_m.count() << "\t" << bench->p99_m.count() << " ns" << std::endl;
+				}
+
 				// log file record
 				logFile_m << std::setw(5) << std::setprecision(1) << std::fixed << ratio * testCase->weight_m;
 				logFile_m << "\t" << testCase->weight_m;
@@ -256,7 +334,12 @@ namespace gats {
 		std::cout << oss.str() << std::endl;
 		logFile_m << oss.str() << std::endl;
 
-		return EXIT_SUCCESS;
+		if (saveBaseline_sm) {
+			save_baseline();
+			cout << white << "Baseline written to " << baselinePath_sm.string() << endl;
+		}
+
+		return nRegressions_sm == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 	}
 
 } // end-of-namespace gats
\ No newline at end of file